@@ -30,7 +30,14 @@
 
 #include "group_theory_bits.hpp"
 
+#include <array>
 #include <cassert>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 /**
  * \file algorithm.hpp
@@ -39,41 +46,102 @@
 namespace clsc {
 
 namespace detail {
-template<typename Regular, typename Integer, typename SemigroupOperation>
-Regular power_accumulate_semigroup(Regular r, Regular a, Integer n, SemigroupOperation op) {
+/*! \brief \c true if \a SemigroupOperation supports the output-parameter protocol.
+ *
+ *  Besides op(lhs, rhs), such an operation provides op(out, lhs, rhs) that stores the product
+ *  into an existing object \a out, which never aliases \a lhs or \a rhs. Power algorithms then
+ *  reuse a fixed set of buffers instead of creating a new Regular at every step, which matters
+ *  for heap-backed types (big numbers, large matrices).
+ */
+template<typename SemigroupOperation, typename Regular, typename = void>
+struct has_output_operation : std::false_type {};
+
+template<typename SemigroupOperation, typename Regular>
+struct has_output_operation<
+    SemigroupOperation, Regular,
+    std::void_t<decltype(std::declval<SemigroupOperation&>()(
+        std::declval<Regular&>(), std::declval<const Regular&>(), std::declval<const Regular&>()))>>
+    : std::true_type {};
+
+template<typename SemigroupOperation, typename Regular>
+constexpr bool has_output_operation_v = has_output_operation<SemigroupOperation, Regular>::value;
+
+struct no_buffer {};
+
+// scratch object for the output-parameter protocol, empty for plain operations
+template<typename SemigroupOperation, typename Regular>
+constexpr auto make_operation_buffer(const Regular& shape) {
+    if constexpr (has_output_operation_v<SemigroupOperation, Regular>) {
+        return Regular(shape);
+    } else {
+        return no_buffer{};
+    }
+}
+
+// x = op(x, y), where y may be x itself
+template<typename Regular, typename SemigroupOperation, typename Buffer>
+constexpr void accumulate_operation(Regular& x, const Regular& y, Buffer& buffer,
+                                    SemigroupOperation& op) {
+    if constexpr (has_output_operation_v<SemigroupOperation, Regular>) {
+        op(buffer, x, y);
+        using std::swap;
+        swap(x, buffer);
+    } else {
+        x = op(x, y);
+    }
+}
+
+template<typename Regular, typename Integer, typename SemigroupOperation, typename Buffer>
+constexpr Regular power_accumulate_semigroup(Regular r, Regular a, Integer n, SemigroupOperation op,
+                                             Buffer& buffer) {
     // requires that domain of SemigroupOperation is Regular type
     while (true) {
         using clsc::detail::half;
         using clsc::detail::odd;
         if (odd(n)) {
-            r = op(r, a);
+            accumulate_operation(r, a, buffer, op);
             if (n == Integer(1)) {
                 return r;
             }
         }
         n = half(n);
-        a = op(a, a);
+        accumulate_operation(a, a, buffer, op);
     }
 }
+
+template<typename Regular, typename Integer, typename SemigroupOperation>
+constexpr Regular power_accumulate_semigroup(Regular r, Regular a, Integer n,
+                                             SemigroupOperation op) {
+    auto buffer = make_operation_buffer<SemigroupOperation>(a);
+    return power_accumulate_semigroup(std::move(r), std::move(a), n, op, buffer);
+}
 }  // namespace detail
 
 template<typename Regular, typename Integer, typename SemigroupOperation>
-Regular power_semigroup(Regular a, Integer n, SemigroupOperation op) {
+constexpr Regular power_semigroup(Regular a, Integer n, SemigroupOperation op) {
     assert(n > 0);
+    if constexpr (detail::has_native_power_v<SemigroupOperation, Regular, Integer>) {
+        return native_power<SemigroupOperation>::apply(a, n, op);
+    } else if constexpr (is_idempotent_v<SemigroupOperation>) {
+        return a;
+    }
     using clsc::detail::half;
     using clsc::detail::odd;
+    auto buffer = detail::make_operation_buffer<SemigroupOperation>(a);
     while (!odd(n)) {
         n = half(n);
-        a = op(a, a);
+        detail::accumulate_operation(a, a, buffer, op);
     }
     if (n == Integer(1)) {
         return a;
     }
-    return detail::power_accumulate_semigroup(a, op(a, a), half(n - 1), op);
+    Regular a2 = op(a, a);
+    return detail::power_accumulate_semigroup(std::move(a), std::move(a2), half(n - 1), op,
+                                              buffer);
 }
 
 template<typename Regular, typename Integer, typename MonoidOperation>
-Regular power_monoid(Regular a, Integer n, MonoidOperation op) {
+constexpr Regular power_monoid(Regular a, Integer n, MonoidOperation op) {
     assert(n >= 0);
     if (n == Integer(0)) {
         using clsc::detail::identity_element;
@@ -83,7 +151,7 @@ Regular power_monoid(Regular a, Integer n, MonoidOperation op) {
 }
 
 template<typename Regular, typename Integer, typename GroupOperation>
-Regular power_group(Regular a, Integer n, GroupOperation op) {
+constexpr Regular power_group(Regular a, Integer n, GroupOperation op) {
     // n - any value
     if (n < 0) {
         n = -n;
@@ -93,4 +161,260 @@ Regular power_group(Regular a, Integer n, GroupOperation op) {
     return power_monoid(a, n, op);
 }
 
+namespace detail {
+// binary digits of a non-negative exponent, least significant first
+template<typename Integer, bool = std::is_integral<Integer>::value> struct exponent_bits {
+    std::vector<bool> bits;
+
+    explicit exponent_bits(Integer n) {
+        using clsc::detail::half;
+        using clsc::detail::odd;
+        while (n != Integer(0)) {
+            bits.push_back(odd(n));
+            n = half(n);
+        }
+    }
+    std::size_t size() const { return bits.size(); }
+    bool operator[](std::size_t i) const { return bits[i]; }
+};
+
+template<typename Integer> struct exponent_bits<Integer, true> {
+    std::array<bool, std::numeric_limits<Integer>::digits> bits = {};
+    std::size_t count = 0;
+
+    explicit exponent_bits(Integer n) {
+        for (; n != Integer(0); n >>= 1) {
+            bits[count++] = bool(n & 0x1);
+        }
+    }
+    std::size_t size() const { return count; }
+    bool operator[](std::size_t i) const { return bits[i]; }
+};
+
+// window width that minimizes the number of operations for an exponent of \a bits bits
+inline std::size_t sliding_window_width(std::size_t bits) {
+    if (bits <= 8)
+        return 1;
+    if (bits <= 24)
+        return 2;
+    if (bits <= 80)
+        return 3;
+    if (bits <= 240)
+        return 4;
+    if (bits <= 672)
+        return 5;
+    return 6;
+}
+
+// a, a^3, a^5, ..., a^(2^width - 1)
+template<typename Regular, typename SemigroupOperation>
+std::vector<Regular> odd_powers_table(Regular a, std::size_t width, SemigroupOperation& op) {
+    const std::size_t count = std::size_t(1) << (width - 1);
+    std::vector<Regular> odd_powers;
+    odd_powers.reserve(count);
+    odd_powers.push_back(std::move(a));
+    if (width > 1) {
+        const Regular a2 = op(odd_powers[0], odd_powers[0]);
+        while (odd_powers.size() < count) {
+            odd_powers.push_back(op(odd_powers.back(), a2));
+        }
+    }
+    return odd_powers;
+}
+
+// value of the window that starts at set bit \a i and ends at the lowest set bit \a l among the
+// next \a width bits
+template<typename Bits>
+std::size_t sliding_window_at(const Bits& bits, std::size_t i, std::size_t width, std::size_t& l) {
+    l = i + 1 >= width ? i + 1 - width : 0;
+    while (!bits[l]) {
+        ++l;
+    }
+    std::size_t value = 0;
+    for (std::size_t j = i + 1; j-- > l;) {
+        value = 2 * value + std::size_t(bits[j]);
+    }
+    return value;
+}
+
+template<typename Regular, typename Integer, typename SemigroupOperation>
+Regular power_sliding_window(Regular a, const exponent_bits<Integer>& bits, std::size_t width,
+                             SemigroupOperation op) {
+    const std::vector<Regular> odd_powers = odd_powers_table(std::move(a), width, op);
+
+    // the most significant bit is set, so the first window initializes the result
+    std::size_t l = 0;
+    std::size_t i = bits.size() - 1;
+    Regular r = odd_powers[sliding_window_at(bits, i, width, l) / 2];
+    auto buffer = make_operation_buffer<SemigroupOperation>(r);
+    while (l > 0) {
+        i = l - 1;
+        if (!bits[i]) {
+            accumulate_operation(r, r, buffer, op);
+            l = i;
+            continue;
+        }
+        const std::size_t value = sliding_window_at(bits, i, width, l);
+        for (std::size_t j = l; j <= i; ++j) {
+            accumulate_operation(r, r, buffer, op);
+        }
+        accumulate_operation(r, odd_powers[value / 2], buffer, op);
+    }
+    return r;
+}
+}  // namespace detail
+
+/*! \brief Sliding-window variant of power_semigroup.
+ *
+ *  Odd powers up to a^(2^W - 1) are precomputed, then the exponent is scanned from the most
+ *  significant bit in windows of at most \a W bits that end with a set bit. For large exponents
+ *  this replaces most of the multiplications of the binary method by table lookups, which pays
+ *  off for expensive operations (matrix or big number products). \a W equal to 0 selects the
+ *  width from the bit length of \a n.
+ */
+template<std::size_t W = 0, typename Regular, typename Integer, typename SemigroupOperation>
+Regular power_semigroup_window(Regular a, Integer n, SemigroupOperation op) {
+    assert(n > 0);
+    static_assert(W < 16, "window width is too large");
+    const detail::exponent_bits<Integer> bits(n);
+    const std::size_t width = W == 0 ? detail::sliding_window_width(bits.size()) : W;
+    return detail::power_sliding_window(std::move(a), bits, width, op);
+}
+
+template<std::size_t W = 0, typename Regular, typename Integer, typename MonoidOperation>
+Regular power_monoid_window(Regular a, Integer n, MonoidOperation op) {
+    assert(n >= 0);
+    if (n == Integer(0)) {
+        using clsc::detail::identity_element;
+        return identity_element(op);
+    }
+    return power_semigroup_window<W>(a, n, op);
+}
+
+template<std::size_t W = 0, typename Regular, typename Integer, typename GroupOperation>
+Regular power_group_window(Regular a, Integer n, GroupOperation op) {
+    // n - any value
+    if (n < 0) {
+        n = -n;
+        using clsc::detail::inverse_element;
+        a = inverse_element(op)(a);
+    }
+    return power_monoid_window<W>(a, n, op);
+}
+
+namespace detail {
+/*! \brief Star addition chain 1 = c[0] < c[1] < ... < c[length] = n, where every element is
+ *         c[k] = c[k - 1] + c[other[k]].
+ */
+struct addition_chain {
+    // beyond this exponent the search is too slow for constant evaluation
+    static constexpr unsigned long long max_searched = 256;
+    static constexpr std::size_t capacity = 16;  // 2 * log2(max_searched) is always enough
+
+    std::size_t length = 0;
+    unsigned long long values[capacity + 1] = {};
+    std::size_t other[capacity + 1] = {};
+};
+
+// depth-first search of a star chain for \a n whose length does not exceed \a limit
+constexpr bool search_addition_chain(addition_chain& chain, std::size_t k, std::size_t limit,
+                                     unsigned long long n) {
+    const unsigned long long last = chain.values[k - 1];
+    if (last == n) {
+        chain.length = k - 1;
+        return true;
+    }
+    // even doubling at every remaining step cannot reach n
+    if (k > limit || (last << (limit - k + 1)) < n) {
+        return false;
+    }
+    for (std::size_t j = k; j-- > 0;) {
+        const unsigned long long next = last + chain.values[j];
+        if (next > n) {
+            continue;
+        }
+        // smaller j only give smaller elements, none of which can reach n anymore
+        if ((next << (limit - k)) < n) {
+            break;
+        }
+        chain.values[k] = next;
+        chain.other[k] = j;
+        if (search_addition_chain(chain, k + 1, limit, n)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// shortest chain: star chains are optimal for all n < 12509
+constexpr addition_chain make_addition_chain(unsigned long long n) {
+    addition_chain chain{};
+    chain.values[0] = 1;
+    std::size_t limit = 0;
+    while (!search_addition_chain(chain, 1, limit, n)) {
+        ++limit;
+    }
+    return chain;
+}
+
+template<unsigned long long N> struct addition_chain_of {
+    static_assert(N > 0 && N <= addition_chain::max_searched, "exponent is out of search range");
+    static constexpr addition_chain value = make_addition_chain(N);
+};
+
+// every chain step is a separate instantiation, so the whole power is straight-line code
+template<unsigned long long N, std::size_t K, typename Regular, typename SemigroupOperation,
+         typename... Values>
+constexpr Regular evaluate_addition_chain(SemigroupOperation& op, const Values&... values) {
+    constexpr const addition_chain& chain = addition_chain_of<N>::value;
+    const auto powers = std::forward_as_tuple(values...);
+    if constexpr (K > chain.length) {
+        return std::get<K - 1>(powers);
+    } else {
+        return evaluate_addition_chain<N, K + 1, Regular>(
+            op, values..., op(std::get<K - 1>(powers), std::get<chain.other[K]>(powers)));
+    }
+}
+
+// left-to-right binary method unrolled over the bits of N below bit Bit
+template<unsigned long long N, int Bit, typename Regular, typename SemigroupOperation>
+constexpr Regular evaluate_binary_power(SemigroupOperation& op, const Regular& r,
+                                        const Regular& a) {
+    if constexpr (Bit < 0) {
+        return r;
+    } else if constexpr (((N >> Bit) & 1u) != 0) {
+        return evaluate_binary_power<N, Bit - 1>(op, op(op(r, r), a), a);
+    } else {
+        return evaluate_binary_power<N, Bit - 1>(op, op(r, r), a);
+    }
+}
+
+constexpr int highest_bit(unsigned long long n) {
+    int bit = -1;
+    for (; n != 0; n >>= 1) {
+        ++bit;
+    }
+    return bit;
+}
+}  // namespace detail
+
+/*! \brief Raises \a a to the compile-time power \a N.
+ *
+ *  Exponents up to addition_chain::max_searched use the shortest addition chain, found during
+ *  compilation, larger ones use the binary method. Either way the power is unrolled into a
+ *  branch-free sequence of \a op calls: e.g. a^5 takes 3 operations and a^17 takes 5. \a N equal
+ *  to 0 requires \a op to be a monoid operation.
+ */
+template<unsigned long long N, typename Regular, typename SemigroupOperation>
+constexpr Regular power(const Regular& a, SemigroupOperation op) {
+    if constexpr (N == 0) {
+        using clsc::detail::identity_element;
+        return identity_element(op);
+    } else if constexpr (N <= detail::addition_chain::max_searched) {
+        return detail::evaluate_addition_chain<N, 1, Regular>(op, a);
+    } else {
+        return detail::evaluate_binary_power<N, detail::highest_bit(N) - 1>(op, a, a);
+    }
+}
+
 }  // namespace clsc
@@ -0,0 +1,153 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include "algorithm.hpp"
+#include "simd_bits.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \file batch_power.hpp
+ * \brief File defines powers of many bases raised to one shared exponent. The control flow of
+ * the binary method depends only on the exponent, so it runs once and every step is applied to
+ * whole vectors of bases.
+ */
+namespace clsc {
+
+namespace detail {
+// independent vectors of bases per step, so that consecutive products do not wait on each other
+constexpr std::size_t batch_power_vectors = 4;
+
+template<typename InputIt, typename OutputIt, typename SemigroupOperation>
+constexpr bool is_simd_batch_power_v =
+    is_contiguous_iterator_v<InputIt> && is_contiguous_iterator_v<OutputIt> &&
+    std::is_same<typename std::iterator_traits<InputIt>::value_type,
+                 typename std::iterator_traits<OutputIt>::value_type>::value &&
+    is_simd_arithmetic_v<typename std::iterator_traits<InputIt>::value_type> &&
+    is_simd_multiplies_v<SemigroupOperation, typename std::iterator_traits<InputIt>::value_type>;
+
+#if defined(CLSC_VECTOR_EXTENSIONS)
+// right-to-left binary method on batch_power_vectors vectors of bases, same order of products as
+// power_semigroup, so floating-point results match the scalar ones exactly. The vectors are
+// expanded from a pack to stay in registers
+template<typename T, typename Integer, typename Op, std::size_t... K>
+void power_semigroup_simd_block(const T* in, T* out, const exponent_bits<Integer>& bits,
+                                std::size_t lowest, Op op, std::index_sequence<K...>) {
+    constexpr std::size_t lanes = simd_lanes<T>;
+    simd_vector<T> a[] = {simd_load(in + K * lanes)...};
+    for (std::size_t i = 0; i < lowest; ++i) {
+        ((a[K] = simd_apply(op, a[K], a[K])), ...);
+    }
+    simd_vector<T> r[] = {a[K]...};
+    for (std::size_t i = lowest + 1; i < bits.size(); ++i) {
+        ((a[K] = simd_apply(op, a[K], a[K])), ...);
+        if (bits[i]) {
+            ((r[K] = simd_apply(op, r[K], a[K])), ...);
+        }
+    }
+    (simd_store(out + K * lanes, r[K]), ...);
+}
+
+template<typename T, typename Integer, typename Op>
+void power_semigroup_simd(const T* first, const T* last, T* out, Integer n, Op op) {
+    constexpr std::ptrdiff_t block = std::ptrdiff_t(batch_power_vectors * simd_lanes<T>);
+    constexpr auto vectors = std::make_index_sequence<batch_power_vectors>{};
+    const exponent_bits<Integer> bits(n);
+    std::size_t lowest = 0;
+    while (!bits[lowest]) {
+        ++lowest;
+    }
+    for (; last - first >= block; first += block, out += block) {
+        power_semigroup_simd_block(first, out, bits, lowest, op, vectors);
+    }
+    if (first != last) {
+        // the tail is padded with ones to a full block
+        T in[block];
+        T result[block];
+        std::fill(std::copy(first, last, in), in + block, T(1));
+        power_semigroup_simd_block(in, result, bits, lowest, op, vectors);
+        std::copy(result, result + (last - first), out);
+    }
+}
+#endif
+}  // namespace detail
+
+/*! \brief Stores power_semigroup(*it, n, op) for every \a it in [first, last) into the range
+ *         starting at \a out and returns the end of that range.
+ *
+ *  For contiguous ranges of arithmetic values and std::multiplies the exponent is scanned once
+ *  and every squaring and multiplication is applied to several SIMD vectors of bases at a time.
+ *  Other types and operations fall back to one power_semigroup call per element. \a out may be
+ *  equal to \a first, otherwise the ranges must not overlap.
+ */
+template<typename InputIt, typename OutputIt, typename Integer, typename SemigroupOperation>
+OutputIt power_semigroup_n(InputIt first, InputIt last, OutputIt out, Integer n,
+                           SemigroupOperation op) {
+    assert(n > 0);
+#if defined(CLSC_VECTOR_EXTENSIONS)
+    if constexpr (detail::is_simd_batch_power_v<InputIt, OutputIt, SemigroupOperation>) {
+        const auto count = std::distance(first, last);
+        if (count > 0) {
+            detail::power_semigroup_simd(&*first, &*first + count, &*out, n, op);
+        }
+        return out + count;
+    }
+#endif
+    for (; first != last; ++first, ++out) {
+        *out = power_semigroup(*first, n, op);
+    }
+    return out;
+}
+
+template<typename InputIt, typename OutputIt, typename Integer, typename MonoidOperation>
+OutputIt power_monoid_n(InputIt first, InputIt last, OutputIt out, Integer n,
+                        MonoidOperation op) {
+    assert(n >= 0);
+    if (n == Integer(0)) {
+        using Regular = typename std::iterator_traits<InputIt>::value_type;
+        if constexpr (detail::is_simd_batch_power_v<InputIt, OutputIt, MonoidOperation>) {
+            return std::fill_n(out, std::distance(first, last), Regular(1));
+        } else {
+            using clsc::detail::identity_element;
+            const Regular identity = identity_element(op);
+            for (; first != last; ++first, ++out) {
+                *out = identity;
+            }
+            return out;
+        }
+    }
+    return power_semigroup_n(first, last, out, n, op);
+}
+
+}  // namespace clsc
@@ -0,0 +1,448 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include "group_theory_bits.hpp"
+#include "polynomial_mod.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file big_unsigned.hpp
+ * \brief File defines an arbitrary-precision non-negative integer. Products switch from the
+ * schoolbook method to Karatsuba to a number-theoretic transform as operands grow, decimal
+ * conversion is divide-and-conquer, so both stay close to linear in the number of digits.
+ */
+namespace clsc {
+
+namespace detail {
+constexpr std::uint64_t big_binary_base = std::uint64_t(1) << 32;
+constexpr std::uint64_t big_decimal_base = 100000000;  // 8 decimal digits per limb
+
+/*! \brief Size thresholds (limbs of the shorter operand) of the multiplication methods.
+ */
+constexpr std::size_t big_karatsuba_threshold = 32;
+constexpr std::size_t big_ntt_threshold = 1024;
+
+// binary limbs below this count are converted to decimal directly in quadratic time
+constexpr std::size_t big_decimal_threshold = 64;
+
+// x[0:nx) += y[0:ny) for nx >= ny, returns the carry out of x[nx - 1]
+template<std::uint64_t Base>
+std::uint32_t big_add(std::uint32_t* x, std::size_t nx, const std::uint32_t* y, std::size_t ny) {
+    std::uint64_t carry = 0;
+    std::size_t i = 0;
+    for (; i < ny; ++i) {
+        const std::uint64_t sum = std::uint64_t(x[i]) + y[i] + carry;
+        carry = sum >= Base;
+        x[i] = std::uint32_t(carry ? sum - Base : sum);
+    }
+    for (; carry != 0 && i < nx; ++i) {
+        const std::uint64_t sum = std::uint64_t(x[i]) + carry;
+        carry = sum >= Base;
+        x[i] = std::uint32_t(carry ? sum - Base : sum);
+    }
+    return std::uint32_t(carry);
+}
+
+// x[0:nx) -= y[0:ny) for x >= y
+template<std::uint64_t Base>
+void big_subtract(std::uint32_t* x, std::size_t nx, const std::uint32_t* y, std::size_t ny) {
+    std::uint64_t borrow = 0;
+    std::size_t i = 0;
+    for (; i < ny; ++i) {
+        const std::uint64_t difference = std::uint64_t(x[i]) + Base - y[i] - borrow;
+        borrow = difference < Base;
+        x[i] = std::uint32_t(borrow ? difference : difference - Base);
+    }
+    for (; borrow != 0; ++i) {
+        assert(i < nx && "subtrahend is larger than minuend");
+        borrow = x[i] == 0;
+        x[i] = std::uint32_t(borrow ? Base - 1 : x[i] - 1);
+    }
+}
+
+// out[0:na + nb) = a * b
+template<std::uint64_t Base>
+void big_schoolbook(const std::uint32_t* a, std::size_t na, const std::uint32_t* b,
+                    std::size_t nb, std::uint32_t* out) {
+    std::fill(out, out + na + nb, 0u);
+    for (std::size_t i = 0; i < na; ++i) {
+        std::uint64_t carry = 0;
+        for (std::size_t j = 0; j < nb; ++j) {
+            // at most (Base - 1)^2 + 2 (Base - 1), which fits for Base <= 2^32
+            const std::uint64_t t = std::uint64_t(a[i]) * b[j] + out[i + j] + carry;
+            out[i + j] = std::uint32_t(t % Base);
+            carry = t / Base;
+        }
+        out[i + nb] = std::uint32_t(carry);
+    }
+}
+
+// the transform works on half-limb digits, so that convolution sums below 2^55 can be recovered
+// from their residues modulo two primes with a product of 2^58.7
+constexpr std::uint32_t big_ntt_prime1 = 998244353;  // 119 * 2^23 + 1
+constexpr std::uint32_t big_ntt_prime2 = 469762049;  // 7 * 2^26 + 1
+
+// limbs of the longest product the transform computes: every limb is two digits, and the cyclic
+// convolution of both primes must hold the whole product. longer products are split
+constexpr std::size_t big_ntt_max_limbs =
+    (std::size_t(1) << std::min(ntt_two_adicity<big_ntt_prime1>(),
+                                ntt_two_adicity<big_ntt_prime2>())) /
+    2;
+
+template<std::uint64_t Base> constexpr std::uint32_t big_digit_base() {
+    static_assert(Base == big_binary_base || Base == big_decimal_base, "unsupported base");
+    return Base == big_binary_base ? 1u << 16 : 10000u;
+}
+
+template<std::uint32_t P, std::uint64_t Base>
+std::vector<std::uint32_t> big_transform(const std::uint32_t* a, std::size_t na,
+                                         std::size_t size) {
+    constexpr std::uint32_t digit = big_digit_base<Base>();
+    std::vector<std::uint32_t> digits(size, 0u);
+    for (std::size_t i = 0; i < na; ++i) {
+        digits[2 * i] = a[i] % digit;
+        digits[2 * i + 1] = a[i] / digit;
+    }
+    ntt<P>(digits, false);
+    return digits;
+}
+
+// cyclic convolution of the digits of a and b modulo P
+template<std::uint32_t P, std::uint64_t Base>
+std::vector<std::uint32_t> big_convolution(const std::uint32_t* a, std::size_t na,
+                                           const std::uint32_t* b, std::size_t nb,
+                                           std::size_t size) {
+    std::vector<std::uint32_t> fa = big_transform<P, Base>(a, na, size);
+    if (a == b && na == nb) {
+        // squaring needs a single forward transform
+        for (auto& x : fa) {
+            x = std::uint32_t(std::uint64_t(x) * x % P);
+        }
+    } else {
+        const std::vector<std::uint32_t> fb = big_transform<P, Base>(b, nb, size);
+        for (std::size_t i = 0; i < size; ++i) {
+            fa[i] = std::uint32_t(std::uint64_t(fa[i]) * fb[i] % P);
+        }
+    }
+    ntt<P>(fa, true);
+    return fa;
+}
+
+// out[0:na + nb) = a * b
+template<std::uint64_t Base>
+void big_multiply_ntt(const std::uint32_t* a, std::size_t na, const std::uint32_t* b,
+                      std::size_t nb, std::uint32_t* out) {
+    constexpr std::uint32_t p1 = big_ntt_prime1;
+    constexpr std::uint32_t p2 = big_ntt_prime2;
+    constexpr std::uint32_t digit = big_digit_base<Base>();
+    // Garner's step: x = r1 + p1 * ((r2 - r1) * p1^-1 mod p2)
+    constexpr std::uint32_t p1_inverse = power_mod_prime<p2>(p1 % p2, p2 - 2);
+
+    std::size_t size = 1;
+    while (size < 2 * (na + nb)) {
+        size <<= 1;
+    }
+    assert(na + nb <= big_ntt_max_limbs && "operands are too long");
+    const std::vector<std::uint32_t> r1 = big_convolution<p1, Base>(a, na, b, nb, size);
+    const std::vector<std::uint32_t> r2 = big_convolution<p2, Base>(a, na, b, nb, size);
+
+    std::uint64_t carry = 0;
+    for (std::size_t i = 0; i < na + nb; ++i) {
+        std::uint32_t halves[2];
+        for (std::size_t k = 0; k < 2; ++k) {
+            const std::uint32_t x1 = r1[2 * i + k];
+            const std::uint32_t x2 = r2[2 * i + k];
+            const std::uint32_t difference = subtract_mod_prime<p2>(x2, x1 % p2);
+            const std::uint64_t t = std::uint64_t(difference) * p1_inverse % p2;
+            carry += x1 + t * p1;
+            halves[k] = std::uint32_t(carry % digit);
+            carry /= digit;
+        }
+        out[i] = halves[0] + halves[1] * digit;
+    }
+    assert(carry == 0);
+}
+
+// out[0:na + nb) = a * b, products of more than \a ntt_limit limbs are split before the transform
+template<std::uint64_t Base>
+void big_multiply(const std::uint32_t* a, std::size_t na, const std::uint32_t* b, std::size_t nb,
+                  std::uint32_t* out, std::size_t ntt_limit = big_ntt_max_limbs) {
+    assert(ntt_limit <= big_ntt_max_limbs);
+    if (na < nb) {
+        std::swap(a, b);
+        std::swap(na, nb);
+    }
+    if (nb < big_karatsuba_threshold) {
+        big_schoolbook<Base>(a, na, b, nb, out);
+        return;
+    }
+    if (nb >= big_ntt_threshold && na + nb <= ntt_limit) {
+        big_multiply_ntt<Base>(a, na, b, nb, out);
+        return;
+    }
+    // longer products go through the slicing or Karatsuba steps below until the parts fit
+    if (na >= 2 * nb) {
+        // unbalanced: slices of a as long as b
+        std::fill(out, out + na + nb, 0u);
+        std::vector<std::uint32_t> slice(2 * nb);
+        for (std::size_t i = 0; i < na; i += nb) {
+            const std::size_t length = std::min(nb, na - i);
+            big_multiply<Base>(a + i, length, b, nb, slice.data(), ntt_limit);
+            big_add<Base>(out + i, na + nb - i, slice.data(), length + nb);
+        }
+        return;
+    }
+    // a = a0 + B^h a1, b = b0 + B^h b1, where nb >= h
+    const std::size_t h = (na + 1) / 2;
+    const std::size_t na1 = na - h;
+    const std::size_t nb1 = nb - h;
+    std::fill(out, out + na + nb, 0u);
+    big_multiply<Base>(a, h, b, h, out, ntt_limit);
+    if (nb1 == 0) {
+        std::vector<std::uint32_t> z2(na1 + h);
+        big_multiply<Base>(a + h, na1, b, h, z2.data(), ntt_limit);
+        big_add<Base>(out + h, na + nb - h, z2.data(), z2.size());
+        return;
+    }
+    big_multiply<Base>(a + h, na1, b + h, nb1, out + 2 * h, ntt_limit);
+    std::vector<std::uint32_t> sum_a(a, a + h + 1);
+    std::vector<std::uint32_t> sum_b(b, b + h + 1);
+    sum_a[h] = big_add<Base>(sum_a.data(), h, a + h, na1);
+    sum_b[h] = big_add<Base>(sum_b.data(), h, b + h, nb1);
+    std::vector<std::uint32_t> z1(2 * h + 2);
+    big_multiply<Base>(sum_a.data(), h + 1, sum_b.data(), h + 1, z1.data(), ntt_limit);
+    big_subtract<Base>(z1.data(), z1.size(), out, 2 * h);
+    big_subtract<Base>(z1.data(), z1.size(), out + 2 * h, na1 + nb1);
+    std::size_t n1 = z1.size();
+    while (n1 > 0 && z1[n1 - 1] == 0) {
+        --n1;
+    }
+    big_add<Base>(out + h, na + nb - h, z1.data(), n1);
+}
+
+template<std::uint64_t Base>
+std::vector<std::uint32_t> big_multiply(const std::vector<std::uint32_t>& a,
+                                        const std::vector<std::uint32_t>& b) {
+    if (a.empty() || b.empty()) {
+        return {};
+    }
+    std::vector<std::uint32_t> out(a.size() + b.size());
+    big_multiply<Base>(a.data(), a.size(), b.data(), b.size(), out.data());
+    if (out.back() == 0) {
+        out.pop_back();
+    }
+    return out;
+}
+
+// decimal limbs of the binary limbs x[0:n), least significant first and without leading zeros;
+// powers[k] holds 2^(32 * 2^k) in decimal limbs
+inline std::vector<std::uint32_t>
+big_to_decimal(const std::uint32_t* x, std::size_t n,
+               std::vector<std::vector<std::uint32_t>>& powers) {
+    while (n > 0 && x[n - 1] == 0) {
+        --n;
+    }
+    std::vector<std::uint32_t> decimal;
+    if (n <= big_decimal_threshold) {
+        // Horner's scheme in the decimal base
+        for (std::size_t i = n; i-- > 0;) {
+            std::uint64_t carry = x[i];
+            for (auto& limb : decimal) {
+                const std::uint64_t t = (std::uint64_t(limb) << 32) + carry;
+                limb = std::uint32_t(t % big_decimal_base);
+                carry = t / big_decimal_base;
+            }
+            for (; carry != 0; carry /= big_decimal_base) {
+                decimal.push_back(std::uint32_t(carry % big_decimal_base));
+            }
+        }
+        return decimal;
+    }
+    // x = high * 2^(32 m) + low with m = 2^k, the largest power of two below n
+    std::size_t k = 0;
+    while ((std::size_t(2) << k) < n) {
+        ++k;
+    }
+    const std::size_t m = std::size_t(1) << k;
+    while (powers.size() <= k) {
+        powers.push_back(big_multiply<big_decimal_base>(powers.back(), powers.back()));
+    }
+    const std::vector<std::uint32_t> high = big_to_decimal(x + m, n - m, powers);
+    const std::vector<std::uint32_t> low = big_to_decimal(x, m, powers);
+    decimal = big_multiply<big_decimal_base>(high, powers[k]);
+    decimal.resize(std::max(decimal.size(), low.size()) + 1, 0u);
+    big_add<big_decimal_base>(decimal.data(), decimal.size(), low.data(), low.size());
+    while (!decimal.empty() && decimal.back() == 0) {
+        decimal.pop_back();
+    }
+    return decimal;
+}
+}  // namespace detail
+
+/*! \brief Arbitrary-precision non-negative integer.
+ *
+ *  Stored as 32-bit limbs, least significant first, without leading zero limbs; zero has no
+ *  limbs. Subtraction requires the minuend to be at least the subtrahend. The type works with
+ *  power_monoid and std::multiplies, products of equal operands are computed as squares.
+ *  Transform-based products are limited to 2^22 limbs, i.e. about 40 million decimal digits.
+ */
+class big_unsigned {
+    std::vector<std::uint32_t> m_limbs;
+
+    void trim() {
+        while (!m_limbs.empty() && m_limbs.back() == 0) {
+            m_limbs.pop_back();
+        }
+    }
+
+public:
+    big_unsigned() = default;
+    big_unsigned(std::uint64_t x) {
+        for (; x != 0; x >>= 32) {
+            m_limbs.push_back(std::uint32_t(x));
+        }
+    }
+    explicit big_unsigned(std::vector<std::uint32_t> limbs) : m_limbs(std::move(limbs)) {
+        trim();
+    }
+
+    const std::vector<std::uint32_t>& limbs() const { return m_limbs; }
+    bool is_zero() const { return m_limbs.empty(); }
+
+    std::size_t bit_length() const {
+        if (m_limbs.empty()) {
+            return 0;
+        }
+        std::size_t bits = 32 * (m_limbs.size() - 1);
+        for (std::uint32_t top = m_limbs.back(); top != 0; top >>= 1) {
+            ++bits;
+        }
+        return bits;
+    }
+
+    friend bool operator==(const big_unsigned& a, const big_unsigned& b) {
+        return a.m_limbs == b.m_limbs;
+    }
+    friend bool operator!=(const big_unsigned& a, const big_unsigned& b) { return !(a == b); }
+    friend bool operator<(const big_unsigned& a, const big_unsigned& b) {
+        if (a.m_limbs.size() != b.m_limbs.size()) {
+            return a.m_limbs.size() < b.m_limbs.size();
+        }
+        return std::lexicographical_compare(a.m_limbs.rbegin(), a.m_limbs.rend(),
+                                            b.m_limbs.rbegin(), b.m_limbs.rend());
+    }
+    friend bool operator>(const big_unsigned& a, const big_unsigned& b) { return b < a; }
+    friend bool operator<=(const big_unsigned& a, const big_unsigned& b) { return !(b < a); }
+    friend bool operator>=(const big_unsigned& a, const big_unsigned& b) { return !(a < b); }
+
+    big_unsigned& operator+=(const big_unsigned& x) {
+        m_limbs.resize(std::max(m_limbs.size(), x.m_limbs.size()) + 1, 0u);
+        detail::big_add<detail::big_binary_base>(m_limbs.data(), m_limbs.size(),
+                                                 x.m_limbs.data(), x.m_limbs.size());
+        trim();
+        return *this;
+    }
+    big_unsigned& operator-=(const big_unsigned& x) {
+        assert(x <= *this);
+        detail::big_subtract<detail::big_binary_base>(m_limbs.data(), m_limbs.size(),
+                                                      x.m_limbs.data(), x.m_limbs.size());
+        trim();
+        return *this;
+    }
+    big_unsigned& operator*=(const big_unsigned& x) { return *this = *this * x; }
+
+    friend big_unsigned operator+(big_unsigned a, const big_unsigned& b) { return a += b; }
+    friend big_unsigned operator-(big_unsigned a, const big_unsigned& b) { return a -= b; }
+    friend big_unsigned operator*(const big_unsigned& a, const big_unsigned& b) {
+        big_unsigned product;
+        product.m_limbs = detail::big_multiply<detail::big_binary_base>(a.m_limbs, b.m_limbs);
+        return product;
+    }
+
+    /*! \brief Returns the decimal limbs (8 digits each), least significant first.
+     *
+     *  The number is split in halves at a power of 2^32, the halves are converted recursively
+     *  and recombined with one product in the decimal base, so the conversion costs O(M(n) log n)
+     *  for n limbs instead of the O(n^2) of repeated division.
+     */
+    std::vector<std::uint32_t> decimal_limbs() const {
+        std::vector<std::vector<std::uint32_t>> powers{
+            {std::uint32_t(detail::big_binary_base % detail::big_decimal_base),
+             std::uint32_t(detail::big_binary_base / detail::big_decimal_base)}};
+        return detail::big_to_decimal(m_limbs.data(), m_limbs.size(), powers);
+    }
+
+    // writes decimal digits limb by limb, without building an intermediate string
+    friend std::ostream& operator<<(std::ostream& os, const big_unsigned& x) {
+        const std::vector<std::uint32_t> decimal = x.decimal_limbs();
+        if (decimal.empty()) {
+            return os << '0';
+        }
+        char digits[16];
+        os << decimal.back();
+        for (std::size_t i = decimal.size() - 1; i-- > 0;) {
+            std::snprintf(digits, sizeof(digits), "%08u", unsigned(decimal[i]));
+            os.write(digits, 8);
+        }
+        return os;
+    }
+
+    std::string to_string() const {
+        const std::vector<std::uint32_t> decimal = decimal_limbs();
+        if (decimal.empty()) {
+            return "0";
+        }
+        std::string s = std::to_string(decimal.back());
+        const std::size_t head = s.size();
+        s.resize(head + 8 * (decimal.size() - 1));
+        for (std::size_t i = decimal.size() - 1, offset = head; i-- > 0; offset += 8) {
+            std::uint32_t limb = decimal[i];
+            for (std::size_t j = 8; j-- > 0; limb /= 10) {
+                s[offset + j] = char('0' + limb % 10);
+            }
+        }
+        return s;
+    }
+};
+
+template<> struct is_commutative<std::plus<big_unsigned>> : std::true_type {};
+template<> struct is_commutative<std::multiplies<big_unsigned>> : std::true_type {};
+
+}  // namespace clsc
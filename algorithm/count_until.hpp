@@ -25,10 +25,20 @@
 // WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
 // OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
 // IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
 #pragma once
 
+#include "parallel_bits.hpp"
+#include "segmented_iterator.hpp"
+#include "simd_bits.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <limits>
+#include <type_traits>
 #include <utility>
 
 /**
@@ -36,27 +46,565 @@
  * \brief File defines count_until algorithms.
  */
 namespace clsc {
+/*! \brief Predicate that holds for elements equal to \a value.
+ *
+ *  count_until and count_until_n recognize this predicate, as well as less_than, greater_than and
+ *  in_range, on contiguous ranges of arithmetic elements of the same type \a T and test a whole
+ *  vector of elements per comparison instead of one element per iteration.
+ */
+template<typename T> struct equal_to_value {
+    T value;
+    constexpr explicit equal_to_value(T v) : value(v) {}
+    constexpr bool operator()(const T& x) const { return x == value; }
+};
+
+/*! \brief Predicate that holds for elements less than \a value.
+ */
+template<typename T> struct less_than {
+    T value;
+    constexpr explicit less_than(T v) : value(v) {}
+    constexpr bool operator()(const T& x) const { return x < value; }
+};
+
+/*! \brief Predicate that holds for elements greater than \a value.
+ */
+template<typename T> struct greater_than {
+    T value;
+    constexpr explicit greater_than(T v) : value(v) {}
+    constexpr bool operator()(const T& x) const { return value < x; }
+};
+
+/*! \brief Predicate that holds for elements in the closed range [\a low, \a high].
+ */
+template<typename T> struct in_range {
+    T low;
+    T high;
+    constexpr in_range(T l, T h) : low(l), high(h) {}
+    constexpr bool operator()(const T& x) const { return low <= x && x <= high; }
+};
+
+/*! \brief Sentinel that compares unequal to every iterator, for scans of ranges known to hold a
+ *         matching element.
+ */
+struct unreachable_sentinel_t {
+    template<typename It> friend constexpr bool operator==(const It&, unreachable_sentinel_t) {
+        return false;
+    }
+    template<typename It> friend constexpr bool operator==(unreachable_sentinel_t, const It&) {
+        return false;
+    }
+    template<typename It> friend constexpr bool operator!=(const It&, unreachable_sentinel_t) {
+        return true;
+    }
+    template<typename It> friend constexpr bool operator!=(unreachable_sentinel_t, const It&) {
+        return true;
+    }
+};
+constexpr unreachable_sentinel_t unreachable_sentinel{};
+
+/*! \brief Sentinel that compares equal to the iterators to elements satisfying \a pred, e.g. the
+ *         NUL terminator of a C string.
+ */
+template<typename Predicate> struct predicate_sentinel {
+    Predicate pred;
+    constexpr explicit predicate_sentinel(Predicate p) : pred(p) {}
+
+    template<typename It>
+    friend constexpr bool operator==(const It& it, const predicate_sentinel& s) {
+        return s.pred(*it);
+    }
+    template<typename It>
+    friend constexpr bool operator==(const predicate_sentinel& s, const It& it) {
+        return s.pred(*it);
+    }
+    template<typename It>
+    friend constexpr bool operator!=(const It& it, const predicate_sentinel& s) {
+        return !s.pred(*it);
+    }
+    template<typename It>
+    friend constexpr bool operator!=(const predicate_sentinel& s, const It& it) {
+        return !s.pred(*it);
+    }
+};
+
+namespace detail {
+// value type of the predicates that count_until evaluates on vectors, void for other predicates
+template<typename Predicate> struct count_until_predicate { using type = void; };
+template<typename T> struct count_until_predicate<equal_to_value<T>> { using type = T; };
+template<typename T> struct count_until_predicate<less_than<T>> { using type = T; };
+template<typename T> struct count_until_predicate<greater_than<T>> { using type = T; };
+template<typename T> struct count_until_predicate<in_range<T>> { using type = T; };
+
+template<typename It, typename Predicate,
+         typename T = typename std::iterator_traits<It>::value_type>
+constexpr bool is_count_until_simd_v =
+    is_contiguous_iterator_v<It> && is_simd_arithmetic_v<T> &&
+    sizeof(T) <= sizeof(std::uint64_t) &&
+    std::is_same<typename count_until_predicate<Predicate>::type, std::remove_cv_t<T>>::value;
+
+#if defined(CLSC_VECTOR_EXTENSIONS)
+template<typename T, std::size_t Bytes>
+using simd_vector_of __attribute__((vector_size(Bytes))) = T;
+
+// the helpers below take and return vectors by reference: they are inlined into kernels compiled
+// for wider vectors than the translation unit, where vector arguments would change the ABI
+
+// lanes of \a v that satisfy \a p as a mask of all-ones and zero lanes
+template<typename V, typename M, typename T>
+__attribute__((always_inline)) inline void count_until_match(const V& v, const equal_to_value<T>& p,
+                                                             M& mask) {
+    mask = v == p.value;
+}
+template<typename V, typename M, typename T>
+__attribute__((always_inline)) inline void count_until_match(const V& v, const less_than<T>& p,
+                                                             M& mask) {
+    mask = v < p.value;
+}
+template<typename V, typename M, typename T>
+__attribute__((always_inline)) inline void count_until_match(const V& v, const greater_than<T>& p,
+                                                             M& mask) {
+    mask = v > p.value;
+}
+template<typename V, typename M, typename T>
+__attribute__((always_inline)) inline void count_until_match(const V& v, const in_range<T>& p,
+                                                             M& mask) {
+    mask = (v >= p.low) & (v <= p.high);
+}
+
+// mask of the vector of elements at \a first
+template<typename V, typename M, typename T, typename Predicate>
+__attribute__((always_inline)) inline void count_until_load_match(const T* first,
+                                                                  const Predicate& p, M& mask) {
+    V v;
+    __builtin_memcpy(&v, first, sizeof(V));
+    count_until_match(v, p, mask);
+}
+
+// nonzero iff some lane of \a mask is set; wide masks are folded in halves down to one word
+template<std::size_t Bytes, typename M>
+__attribute__((always_inline)) inline std::uint64_t count_until_any(const M& mask) {
+    using W = simd_vector_of<std::uint64_t, Bytes>;
+    const W w = reinterpret_cast<W>(mask);
+    if constexpr (Bytes == 32) {
+        const simd_vector_of<std::uint64_t, 16> h =
+            __builtin_shufflevector(w, w, 0, 1) | __builtin_shufflevector(w, w, 2, 3);
+        return h[0] | h[1];
+    } else {
+        static_assert(Bytes == 16, "unexpected vector width");
+        return w[0] | w[1];
+    }
+}
+
+// index of the first set lane of \a mask, or the number of lanes if there is none
+template<typename T, std::size_t Bytes, typename M>
+__attribute__((always_inline)) inline std::size_t count_until_first(const M& mask) {
+    using W = simd_vector_of<std::uint64_t, Bytes>;
+    const W w = reinterpret_cast<W>(mask);
+    for (std::size_t j = 0; j < Bytes / sizeof(std::uint64_t); ++j) {
+        if (w[j] != 0) {
+            return (j * sizeof(std::uint64_t) + std::size_t(__builtin_ctzll(w[j])) / 8) / sizeof(T);
+        }
+    }
+    return Bytes / sizeof(T);
+}
+
+// index of the first element of [first, first + n) that satisfies \a p, or n. Blocks of
+// sizeof...(K) vectors are tested with a single branch on the folded masks; a hit is then located
+// with a count of trailing zeros in the mask of its vector
+template<std::size_t Bytes, typename T, typename Predicate, std::size_t... K>
+__attribute__((always_inline)) inline std::size_t
+count_until_kernel(const T* first, std::size_t n, const Predicate& p, std::index_sequence<K...>) {
+    using V = simd_vector_of<T, Bytes>;
+    using M = decltype(V{} == V{});
+    constexpr std::size_t lanes = Bytes / sizeof(T);
+    constexpr std::size_t block = sizeof...(K) * lanes;
+
+    std::size_t i = 0;
+    for (; n - i >= block; i += block) {
+        M mask[sizeof...(K)];
+        (count_until_load_match<V>(first + i + K * lanes, p, mask[K]), ...);
+        const M any = (mask[K] | ...);
+        if (count_until_any<Bytes>(any) != 0) {
+            for (std::size_t k = 0;; ++k) {
+                if (count_until_any<Bytes>(mask[k]) != 0) {
+                    return i + k * lanes + count_until_first<T, Bytes>(mask[k]);
+                }
+            }
+        }
+    }
+    for (; n - i >= lanes; i += lanes) {
+        M mask;
+        count_until_load_match<V>(first + i, p, mask);
+        if (count_until_any<Bytes>(mask) != 0) {
+            return i + count_until_first<T, Bytes>(mask);
+        }
+    }
+    for (; i < n; ++i) {
+        if (p(first[i])) {
+            break;
+        }
+    }
+    return i;
+}
+
+// vectors tested per branch of the kernels
+constexpr std::size_t count_until_unroll = 4;
+
+template<typename T, typename Predicate>
+std::size_t count_until_default(const T* first, std::size_t n, const Predicate& p) {
+    return count_until_kernel<simd_bytes>(first, n, p,
+                                         std::make_index_sequence<count_until_unroll>{});
+}
+
+#if defined(CLSC_X86_SIMD) && !defined(__AVX2__)
+template<typename T, typename Predicate>
+__attribute__((target("avx2"))) std::size_t count_until_avx2(const T* first, std::size_t n,
+                                                             const Predicate& p) {
+    return count_until_kernel<32>(first, n, p, std::make_index_sequence<count_until_unroll>{});
+}
+#endif
+
+// the vector kernel for the widest instruction set available at run time: AVX2 if the processor
+// has it, otherwise the one the translation unit is compiled for (SSE2 on x86-64)
+template<typename T, typename Predicate>
+std::size_t count_until_simd(const T* first, std::size_t n, const Predicate& p) {
+#if defined(CLSC_X86_SIMD) && !defined(__AVX2__)
+    if (cpu_has_avx2()) {
+        return count_until_avx2(first, n, p);
+    }
+#endif
+    return count_until_default(first, n, p);
+}
+#endif
+
+// count_until over a range scanned as a whole
 template<typename InputIt, typename UnaryPredicate>
 std::pair<InputIt, typename std::iterator_traits<InputIt>::difference_type>
-count_until(InputIt first, InputIt last, UnaryPredicate p) {
+count_until_plain(InputIt first, InputIt last, UnaryPredicate& p) {
     typename std::iterator_traits<InputIt>::difference_type ret = 0;
-    for (; first != last; ++first, ++ret) {
-        if (p(*first)) {
-            break;
+#if defined(CLSC_VECTOR_EXTENSIONS)
+    if constexpr (is_count_until_simd_v<InputIt, UnaryPredicate>) {
+        if (first == last) {
+            return {first, ret};
         }
+        ret = decltype(ret)(count_until_simd(&*first, std::size_t(last - first), p));
+        return {first + ret, ret};
+    }
+#endif
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of<std::random_access_iterator_tag, category>::value) {
+        // the count follows from the position, the loop carries a single induction variable
+        const InputIt start = first;
+        for (; first != last; ++first) {
+            if (p(*first)) {
+                break;
+            }
+        }
+        return {first, first - start};
+    } else {
+        for (; first != last; ++first, ++ret) {
+            if (p(*first)) {
+                break;
+            }
+        }
+        return {first, ret};
+    }
+}
+
+// count_until over the local range of every segment between \a first and \a last in turn
+template<typename SegmentedIt, typename UnaryPredicate>
+std::pair<SegmentedIt, typename std::iterator_traits<SegmentedIt>::difference_type>
+count_until_segmented(SegmentedIt first, SegmentedIt last, UnaryPredicate& p) {
+    using traits = segmented_iterator_traits<SegmentedIt>;
+    typename std::iterator_traits<SegmentedIt>::difference_type ret = 0;
+    if (first == last) {
+        return {first, ret};
+    }
+    auto segment = traits::segment(first);
+    const auto last_segment = traits::segment(last);
+    auto local = traits::local(first);
+    for (;;) {
+        const bool is_last = segment == last_segment;
+        const auto local_last = is_last ? traits::local(last) : traits::end(segment);
+        const auto found = count_until_plain(local, local_last, p);
+        ret += found.second;
+        if (found.first != local_last) {
+            return {traits::compose(segment, found.first), ret};
+        }
+        if (is_last) {
+            return {last, ret};
+        }
+        ++segment;
+        local = traits::begin(segment);
+    }
+}
+
+// elements tested per iteration of the unbounded scan
+constexpr std::size_t count_until_unbounded_unroll = 4;
+
+// count_until over a range that is known to hold an element satisfying \a p: the loop tests no
+// bounds and random access ones test count_until_unbounded_unroll elements per iteration
+template<typename InputIt, typename UnaryPredicate, std::size_t... K>
+std::pair<InputIt, typename std::iterator_traits<InputIt>::difference_type>
+count_until_unbounded(InputIt first, UnaryPredicate& p, std::index_sequence<K...>) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    using difference_type = typename std::iterator_traits<InputIt>::difference_type;
+    if constexpr (std::is_base_of<std::random_access_iterator_tag, category>::value) {
+        constexpr auto unroll = difference_type(sizeof...(K));
+        for (difference_type ret = 0;; ret += unroll) {
+            // elements past the first match are never read, they may lie beyond the range
+            difference_type hit = unroll;
+            const auto test = [&](difference_type k) {
+                return p(first[ret + k]) && (hit = k, true);
+            };
+            (void)(test(difference_type(K)) || ...);
+            if (hit != unroll) {
+                return {first + (ret + hit), ret + hit};
+            }
+        }
+    } else {
+        difference_type ret = 0;
+        for (; !p(*first); ++first, ++ret) {
+        }
+        return {first, ret};
     }
-    return {first, ret};
 }
+}  // namespace detail
 
+/*! \brief Counts the elements of [\a first, \a last) before the first one that satisfies \a p.
+ *
+ *  Returns the iterator to that element (or \a last) together with the count. The predicates
+ *  equal_to_value, less_than, greater_than and in_range are evaluated on vectors of elements when
+ *  the range is contiguous; the result is the same as with an equivalent lambda. Ranges of
+ *  segmented iterators (see segmented_iterator_traits) are scanned one segment at a time, so the
+ *  same applies to every segment of e.g. std::deque.
+ */
+template<typename InputIt, typename UnaryPredicate>
+std::pair<InputIt, typename std::iterator_traits<InputIt>::difference_type>
+count_until(InputIt first, InputIt last, UnaryPredicate p) {
+    if constexpr (is_segmented_iterator_v<InputIt>) {
+        return detail::count_until_segmented(first, last, p);
+    } else {
+        return detail::count_until_plain(first, last, p);
+    }
+}
+
+/*! \brief Same as count_until, but the end of the range is given by a sentinel of another type
+ *         than the iterators, e.g. unreachable_sentinel or a predicate_sentinel.
+ *
+ *  With unreachable_sentinel the range must hold an element satisfying \a p: the scan then tests
+ *  no bounds, and elements of random access ranges are tested several per loop iteration.
+ */
+template<typename InputIt, typename Sentinel, typename UnaryPredicate,
+         typename = std::enable_if_t<!std::is_same<InputIt, Sentinel>::value>>
+std::pair<InputIt, typename std::iterator_traits<InputIt>::difference_type>
+count_until(InputIt first, Sentinel last, UnaryPredicate p) {
+    if constexpr (std::is_same<Sentinel, unreachable_sentinel_t>::value) {
+        (void)last;
+        return detail::count_until_unbounded(
+            first, p, std::make_index_sequence<detail::count_until_unbounded_unroll>{});
+    } else {
+        typename std::iterator_traits<InputIt>::difference_type ret = 0;
+        for (; first != last; ++first, ++ret) {
+            if (p(*first)) {
+                break;
+            }
+        }
+        return {first, ret};
+    }
+}
+
+/*! \brief Counts the elements of [\a first, \a first + \a n) before the first one that satisfies
+ *         \a p.
+ *
+ *  Same as count_until, including the vectorized predicates and the scans of random access
+ *  segmented iterators segment by segment.
+ */
 template<typename InputIt, typename N, typename UnaryPredicate>
 std::pair<InputIt, typename std::iterator_traits<InputIt>::difference_type>
 count_until_n(InputIt first, N n, UnaryPredicate p) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
     typename std::iterator_traits<InputIt>::difference_type ret = 0;
-    for (; n--; ++first, ++ret) {
-        if (p(*first)) {
-            break;
+    if constexpr (is_segmented_iterator_v<InputIt> &&
+                  std::is_base_of<std::random_access_iterator_tag, category>::value) {
+        if (n <= 0) {
+            return {first, ret};
+        }
+        return detail::count_until_segmented(first, first + decltype(ret)(n), p);
+    } else {
+#if defined(CLSC_VECTOR_EXTENSIONS)
+        if constexpr (detail::is_count_until_simd_v<InputIt, UnaryPredicate>) {
+            if (n <= 0) {
+                return {first, ret};
+            }
+            ret = decltype(ret)(detail::count_until_simd(&*first, std::size_t(n), p));
+            return {first + ret, ret};
+        }
+#endif
+        for (; n--; ++first, ++ret) {
+            if (p(*first)) {
+                break;
+            }
         }
+        return {first, ret};
+    }
+}
+
+namespace detail {
+// elements a worker scans before it checks the best known match again
+constexpr std::size_t count_until_chunk = std::size_t(1) << 16;
+
+// index of the first element of [first, first + n) that satisfies \a p, or n. Workers claim
+// chunks in sequence order and publish matches through an atomic minimum, so once a match is
+// known the chunks beyond it are skipped; a chunk before it is always scanned completely
+template<typename RandomIt, typename UnaryPredicate>
+std::size_t count_until_parallel(RandomIt first, std::size_t n, const UnaryPredicate& p,
+                                 std::size_t threads) {
+    const std::size_t workers = worker_count(n, threads, parallel_min_chunk);
+    if (workers == 1) {
+        return std::size_t(count_until(first, first + n, p).second);
+    }
+
+    const std::size_t chunks = (n + count_until_chunk - 1) / count_until_chunk;
+    std::atomic<std::size_t> next_chunk{0};
+    std::atomic<std::size_t> best{n};
+    parallel_invoke_n(workers, [&](std::size_t) {
+        for (;;) {
+            const std::size_t chunk = next_chunk.fetch_add(1, std::memory_order_relaxed);
+            const std::size_t begin = chunk * count_until_chunk;
+            if (chunk >= chunks || begin >= best.load(std::memory_order_relaxed)) {
+                return;
+            }
+            const std::size_t end = std::min(n, begin + count_until_chunk);
+            const std::size_t hit =
+                begin + std::size_t(count_until(first + begin, first + end, p).second);
+            if (hit < end) {
+                std::size_t current = best.load(std::memory_order_relaxed);
+                while (hit < current &&
+                       !best.compare_exchange_weak(current, hit, std::memory_order_relaxed)) {
+                }
+                // chunks claimed later by this worker lie beyond the hit
+                return;
+            }
+        }
+    });
+    return best.load(std::memory_order_relaxed);
+}
+}  // namespace detail
+
+/*! \brief Same as count_until, but long ranges are split between \a threads threads (0 means
+ *         one per hardware thread).
+ *
+ *  The result is the same as that of the sequential version: workers scan chunks in sequence
+ *  order and stop at the chunks that lie beyond the first match found so far. \a p is called
+ *  concurrently from several threads.
+ */
+template<typename RandomIt, typename UnaryPredicate>
+std::pair<RandomIt, typename std::iterator_traits<RandomIt>::difference_type>
+count_until(RandomIt first, RandomIt last, UnaryPredicate p, std::size_t threads) {
+    using difference_type = typename std::iterator_traits<RandomIt>::difference_type;
+    const auto ret =
+        difference_type(detail::count_until_parallel(first, std::size_t(last - first), p, threads));
+    return {first + ret, ret};
+}
+
+/*! \brief Same as count_until_n, but long ranges are split between \a threads threads (0 means
+ *         one per hardware thread).
+ */
+template<typename RandomIt, typename N, typename UnaryPredicate>
+std::pair<RandomIt, typename std::iterator_traits<RandomIt>::difference_type>
+count_until_n(RandomIt first, N n, UnaryPredicate p, std::size_t threads) {
+    using difference_type = typename std::iterator_traits<RandomIt>::difference_type;
+    if (n <= 0) {
+        return {first, 0};
+    }
+    const auto ret =
+        difference_type(detail::count_until_parallel(first, std::size_t(n), p, threads));
+    return {first + ret, ret};
+}
+
+namespace detail {
+// a value satisfying the recognized predicate \a p, if there is one, is written to \a guard
+template<typename T> bool count_until_guard(const equal_to_value<T>& p, T& guard) {
+    guard = p.value;
+    return true;
+}
+template<typename T> bool count_until_guard(const less_than<T>& p, T& guard) {
+    guard = std::numeric_limits<T>::lowest();
+    return std::numeric_limits<T>::is_specialized && guard < p.value;
+}
+template<typename T> bool count_until_guard(const greater_than<T>& p, T& guard) {
+    guard = std::numeric_limits<T>::max();
+    return std::numeric_limits<T>::is_specialized && p.value < guard;
+}
+template<typename T> bool count_until_guard(const in_range<T>& p, T& guard) {
+    guard = p.low;
+    return p.low <= p.high;
+}
+
+// puts the element replaced by the guard back, also when the predicate throws
+template<typename RandomIt> struct count_until_guard_restore {
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+    RandomIt position;
+    value_type saved;
+    ~count_until_guard_restore() { *position = std::move(saved); }
+};
+}  // namespace detail
+
+/*! \brief Same as count_until for a mutable random access range, scanned without bounds checks.
+ *
+ *  The last element is temporarily replaced by \a guard, which must satisfy \a p, so that the
+ *  unbounded, unrolled scan of count_until with unreachable_sentinel stops within the range. The
+ *  element is put back before returning, also on exceptions; the range must not be accessed by
+ *  other threads meanwhile. Segmented ranges are scanned by count_until segment by segment
+ *  instead.
+ */
+template<typename RandomIt, typename UnaryPredicate>
+std::pair<RandomIt, typename std::iterator_traits<RandomIt>::difference_type>
+count_until_guarded(RandomIt first, RandomIt last, UnaryPredicate p,
+                    typename std::iterator_traits<RandomIt>::value_type guard) {
+    assert(p(guard));
+    if constexpr (is_segmented_iterator_v<RandomIt>) {
+        return count_until(first, last, p);
+    }
+    if (first == last) {
+        return {first, 0};
+    }
+    const RandomIt back = last - 1;
+    std::pair<RandomIt, typename std::iterator_traits<RandomIt>::difference_type> found;
+    {
+        detail::count_until_guard_restore<RandomIt> restore{back, std::move(*back)};
+        *back = std::move(guard);
+        found = detail::count_until_unbounded(
+            first, p, std::make_index_sequence<detail::count_until_unbounded_unroll>{});
+    }
+    if (found.first == back && !p(*back)) {
+        return {last, found.second + 1};
+    }
+    return found;
+}
+
+/*! \brief Same as count_until_guarded, with a guard derived from the recognized predicate \a p
+ *         (equal_to_value, less_than, greater_than or in_range).
+ *
+ *  Contiguous ranges of arithmetic elements, which count_until scans with vectors, and predicates
+ *  that no value satisfies are scanned by count_until instead.
+ */
+template<typename RandomIt, typename UnaryPredicate,
+         typename T = typename detail::count_until_predicate<UnaryPredicate>::type,
+         typename = std::enable_if_t<!std::is_void<T>::value>>
+std::pair<RandomIt, typename std::iterator_traits<RandomIt>::difference_type>
+count_until_guarded(RandomIt first, RandomIt last, UnaryPredicate p) {
+#if defined(CLSC_VECTOR_EXTENSIONS)
+    if constexpr (detail::is_count_until_simd_v<RandomIt, UnaryPredicate>) {
+        return count_until(first, last, p);
+    }
+#endif
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+    T guard{};
+    if (!detail::count_until_guard(p, guard) || !p(value_type(guard))) {
+        return count_until(first, last, p);
     }
-    return {first, ret};
+    return count_until_guarded(first, last, p, value_type(guard));
 }
 }  // namespace clsc
@@ -0,0 +1,336 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include "matrix.hpp"
+#include "parallel_bits.hpp"
+#include "simd_bits.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+/**
+ * \file dense_matrix.hpp
+ * \brief File defines dynamically sized dense matrices, whose multiplication is blocked for the
+ * cache hierarchy, packs operands into contiguous panels, runs a register-tiled SIMD
+ * micro-kernel and splits rows between threads. The multiplication is a semigroup operation
+ * with the output-parameter protocol, so power_semigroup reuses all buffers between squarings.
+ */
+namespace clsc {
+
+/*! \brief Row-major \a rows x \a cols matrix of \a T in a single heap allocation.
+ */
+template<typename T> class dense_matrix {
+    std::size_t m_rows = 0;
+    std::size_t m_cols = 0;
+    std::vector<T> m_data;
+
+public:
+    dense_matrix() = default;
+    dense_matrix(std::size_t rows, std::size_t cols, T value = T(0))
+        : m_rows(rows), m_cols(cols), m_data(rows * cols, value) {}
+
+    static dense_matrix identity(std::size_t n) {
+        dense_matrix m(n, n);
+        for (std::size_t i = 0; i < n; ++i) {
+            m(i, i) = T(1);
+        }
+        return m;
+    }
+
+    std::size_t rows() const { return m_rows; }
+    std::size_t cols() const { return m_cols; }
+
+    // changes the shape, element values are unspecified afterwards
+    void reshape(std::size_t rows, std::size_t cols) {
+        m_rows = rows;
+        m_cols = cols;
+        m_data.resize(rows * cols);
+    }
+
+    T* data() { return m_data.data(); }
+    const T* data() const { return m_data.data(); }
+
+    T& operator()(std::size_t i, std::size_t j) { return m_data[i * m_cols + j]; }
+    const T& operator()(std::size_t i, std::size_t j) const { return m_data[i * m_cols + j]; }
+
+    friend bool operator==(const dense_matrix& a, const dense_matrix& b) {
+        return a.m_rows == b.m_rows && a.m_cols == b.m_cols && a.m_data == b.m_data;
+    }
+    friend bool operator!=(const dense_matrix& a, const dense_matrix& b) { return !(a == b); }
+};
+
+namespace detail {
+/*! \brief Register tile and cache block sizes of the dense multiplication.
+ *
+ *  The micro-kernel keeps an mr x nr tile of the result in registers. A kc x nr panel of the
+ *  right operand is meant to stay in L1, an mc x kc block of the left operand in L2 and a
+ *  kc x nc block of the right operand in L3.
+ */
+template<typename T> struct dense_blocking {
+#if defined(CLSC_VECTOR_EXTENSIONS)
+    static constexpr bool vectorized = is_matrix_simd_v<T>;
+    static constexpr std::size_t lanes = vectorized ? simd_lanes<T> : 1;
+#else
+    static constexpr bool vectorized = false;
+    static constexpr std::size_t lanes = 1;
+#endif
+    static constexpr std::size_t mr = 4;
+    static constexpr std::size_t nr = vectorized ? 2 * lanes : 4;
+    static constexpr std::size_t kc = 256;
+    static constexpr std::size_t mc = 128;
+    static constexpr std::size_t nc = 2048;
+    // rows of the result per thread, smaller products run on the calling thread
+    static constexpr std::size_t min_rows_per_thread = 64;
+};
+
+// ordinary sums of products, the semiring of dense_matrix_multiplies. a semiring policy gives the
+// neutral element of its addition, multiply_add(acc, a, b) = acc + a * b and add(x, y) for scalars
+// and vectors alike, and normalize(x) applied to every stored result
+template<typename T> struct plus_times_semiring {
+    static constexpr T zero() { return T(0); }
+    template<typename V> static V multiply_add(V acc, V a, V b) { return acc + a * b; }
+    template<typename V> static V add(V x, V y) { return x + y; }
+    template<typename V> static V normalize(V x) { return x; }
+};
+
+// c[0:rows, 0:cols] = (or +=) a * b for an mr-row panel a and an nr-column panel b of depth kc,
+// both packed by dense_pack_*, with the arithmetic of \a Semiring
+template<typename Semiring, typename T>
+void dense_micro_kernel(std::size_t kc, const T* a, const T* b, T* c, std::size_t ldc,
+                        std::size_t rows, std::size_t cols, bool accumulate) {
+    using blocking = dense_blocking<T>;
+    constexpr std::size_t mr = blocking::mr;
+    constexpr std::size_t nr = blocking::nr;
+    T tile[mr * nr];
+#if defined(CLSC_VECTOR_EXTENSIONS)
+    if constexpr (blocking::vectorized) {
+        constexpr std::size_t lanes = blocking::lanes;
+        const simd_vector<T> zero = simd_broadcast(Semiring::zero());
+        simd_vector<T> acc[mr][2];
+        for (std::size_t r = 0; r < mr; ++r) {
+            acc[r][0] = zero;
+            acc[r][1] = zero;
+        }
+        for (std::size_t p = 0; p < kc; ++p, a += mr, b += nr) {
+            const simd_vector<T> b0 = simd_load(b);
+            const simd_vector<T> b1 = simd_load(b + lanes);
+            for (std::size_t r = 0; r < mr; ++r) {
+                const simd_vector<T> ar = simd_broadcast(a[r]);
+                acc[r][0] = Semiring::multiply_add(acc[r][0], ar, b0);
+                acc[r][1] = Semiring::multiply_add(acc[r][1], ar, b1);
+            }
+        }
+        if (rows == mr && cols == nr) {
+            for (std::size_t r = 0; r < mr; ++r, c += ldc) {
+                if (accumulate) {
+                    acc[r][0] = Semiring::add(simd_load(c), acc[r][0]);
+                    acc[r][1] = Semiring::add(simd_load(c + lanes), acc[r][1]);
+                }
+                simd_store(c, Semiring::normalize(acc[r][0]));
+                simd_store(c + lanes, Semiring::normalize(acc[r][1]));
+            }
+            return;
+        }
+        for (std::size_t r = 0; r < mr; ++r) {
+            simd_store(tile + r * nr, acc[r][0]);
+            simd_store(tile + r * nr + lanes, acc[r][1]);
+        }
+    } else
+#endif
+    {
+        std::fill(tile, tile + mr * nr, Semiring::zero());
+        for (std::size_t p = 0; p < kc; ++p, a += mr, b += nr) {
+            for (std::size_t r = 0; r < mr; ++r) {
+                for (std::size_t j = 0; j < nr; ++j) {
+                    tile[r * nr + j] = Semiring::multiply_add(tile[r * nr + j], a[r], b[j]);
+                }
+            }
+        }
+    }
+    for (std::size_t r = 0; r < rows; ++r, c += ldc) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            const T value = tile[r * nr + j];
+            c[j] = Semiring::normalize(accumulate ? Semiring::add(c[j], value) : value);
+        }
+    }
+}
+
+// a[i0:i0+mc, p0:p0+kc] as mr-row panels, column by column, missing rows are zero. results of
+// padding rows and columns are never stored, so the padding value does not matter
+template<typename T>
+void dense_pack_left(const dense_matrix<T>& a, std::size_t i0, std::size_t mc, std::size_t p0,
+                     std::size_t kc, T* packed) {
+    constexpr std::size_t mr = dense_blocking<T>::mr;
+    for (std::size_t i = 0; i < mc; i += mr) {
+        const std::size_t rows = std::min(mr, mc - i);
+        for (std::size_t p = 0; p < kc; ++p) {
+            for (std::size_t r = 0; r < mr; ++r) {
+                *packed++ = r < rows ? a(i0 + i + r, p0 + p) : T(0);
+            }
+        }
+    }
+}
+
+// b[p0:p0+kc, j0:j0+nc] as nr-column panels, row by row, missing columns are zero
+template<typename T>
+void dense_pack_right(const dense_matrix<T>& b, std::size_t p0, std::size_t kc, std::size_t j0,
+                      std::size_t nc, T* packed) {
+    constexpr std::size_t nr = dense_blocking<T>::nr;
+    for (std::size_t j = 0; j < nc; j += nr) {
+        const std::size_t cols = std::min(nr, nc - j);
+        for (std::size_t p = 0; p < kc; ++p) {
+            const T* row = &b(p0 + p, j0 + j);
+            for (std::size_t q = 0; q < nr; ++q) {
+                *packed++ = q < cols ? row[q] : T(0);
+            }
+        }
+    }
+}
+
+// packing buffers of dense_multiply, kept between products
+template<typename T> struct dense_buffers {
+    std::vector<T> packed_right;
+    std::vector<std::vector<T>> packed_left;  // one per worker
+};
+
+// c = a * b in \a Semiring, c must not alias a or b
+template<typename Semiring, typename T>
+void dense_multiply(dense_matrix<T>& c, const dense_matrix<T>& a, const dense_matrix<T>& b,
+                    std::size_t threads, dense_buffers<T>& buffers) {
+    using blocking = dense_blocking<T>;
+    assert(a.cols() == b.rows());
+    assert(&c != &a && &c != &b);
+    const std::size_t m = a.rows();
+    const std::size_t n = b.cols();
+    const std::size_t k = a.cols();
+    c.reshape(m, n);
+    if (k == 0) {
+        std::fill(c.data(), c.data() + m * n, Semiring::zero());
+        return;
+    }
+    constexpr std::size_t mr = blocking::mr;
+    constexpr std::size_t nr = blocking::nr;
+    const std::size_t panels = (m + mr - 1) / mr;
+    const std::size_t workers = worker_count(m, threads, blocking::min_rows_per_thread);
+    buffers.packed_right.resize(blocking::kc * (blocking::nc + nr));
+    buffers.packed_left.resize(workers);
+    for (auto& packed : buffers.packed_left) {
+        packed.resize(blocking::mc * blocking::kc);
+    }
+
+    const std::size_t right_panels = (std::min(n, blocking::nc) + nr - 1) / nr;
+
+    // one parallel region for the whole product: the workers pack the shared block of the right
+    // operand together and meet at a barrier before using it and before overwriting it
+    thread_barrier barrier(workers);
+    parallel_invoke_n(workers, [&](std::size_t worker) {
+        // whole mr-row panels per worker
+        const auto rows = chunk_bounds(panels, workers, worker);
+        const std::size_t end = std::min(m, rows.second * mr);
+        T* packed_left = buffers.packed_left[worker].data();
+        T* packed_right = buffers.packed_right.data();
+        for (std::size_t j0 = 0; j0 < n; j0 += blocking::nc) {
+            const std::size_t nc = std::min(blocking::nc, n - j0);
+            // whole nr-column panels of the right block per worker
+            const auto cols = chunk_bounds(right_panels, workers, worker);
+            const std::size_t first = std::min(nc, cols.first * nr);
+            const std::size_t last = std::min(nc, cols.second * nr);
+            for (std::size_t p0 = 0; p0 < k; p0 += blocking::kc) {
+                const std::size_t kc = std::min(blocking::kc, k - p0);
+                const bool accumulate = p0 != 0;
+                if (first < last) {
+                    dense_pack_right(b, p0, kc, j0 + first, last - first,
+                                     packed_right + first * kc);
+                }
+                barrier.arrive_and_wait();
+                for (std::size_t i0 = rows.first * mr; i0 < end; i0 += blocking::mc) {
+                    const std::size_t mc = std::min(blocking::mc, end - i0);
+                    dense_pack_left(a, i0, mc, p0, kc, packed_left);
+                    for (std::size_t j = 0; j < nc; j += nr) {
+                        const T* right = packed_right + j * kc;
+                        for (std::size_t i = 0; i < mc; i += mr) {
+                            dense_micro_kernel<Semiring>(kc, packed_left + i * kc, right,
+                                                         &c(i0 + i, j0 + j), n,
+                                                         std::min(mr, mc - i),
+                                                         std::min(nr, nc - j), accumulate);
+                        }
+                    }
+                }
+                barrier.arrive_and_wait();
+            }
+        }
+    });
+}
+}  // namespace detail
+
+/*! \brief Multiplication of dense_matrix objects.
+ *
+ *  The product is computed block by block (Goto's algorithm): a block of the right operand is
+ *  packed once and shared, every thread packs its own blocks of the left operand and runs the
+ *  micro-kernel over them. The threads are started once per product and synchronize at a
+ *  barrier around every block of the right operand, which they pack together. Packing buffers
+ *  live in the operation object and are reused by every product it computes, which
+ *  power_semigroup does for all squarings; the object must therefore not be used by several
+ *  threads at once. \a threads == 0 means one thread per core.
+ *
+ *  \a order is the size of the identity_element, needed only by power_monoid with n == 0.
+ */
+template<typename T> class dense_matrix_multiplies {
+    std::size_t m_order = 0;
+    std::size_t m_threads = 0;
+    mutable detail::dense_buffers<T> m_buffers;
+
+public:
+    explicit dense_matrix_multiplies(std::size_t order = 0, std::size_t threads = 0)
+        : m_order(order), m_threads(threads) {}
+
+    // c = a * b, c must not alias a or b
+    void operator()(dense_matrix<T>& c, const dense_matrix<T>& a, const dense_matrix<T>& b) const {
+        detail::dense_multiply<detail::plus_times_semiring<T>>(c, a, b, m_threads, m_buffers);
+    }
+
+    dense_matrix<T> operator()(const dense_matrix<T>& a, const dense_matrix<T>& b) const {
+        dense_matrix<T> c;
+        (*this)(c, a, b);
+        return c;
+    }
+
+    friend dense_matrix<T> identity_element(const dense_matrix_multiplies& op) {
+        return dense_matrix<T>::identity(op.m_order);
+    }
+};
+
+template<typename T> dense_matrix<T> operator*(const dense_matrix<T>& a, const dense_matrix<T>& b) {
+    return dense_matrix_multiplies<T>{}(a, b);
+}
+
+}  // namespace clsc
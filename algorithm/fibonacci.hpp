@@ -29,14 +29,27 @@
 #pragma once
 
 #include "algorithm.hpp"
+#include "big_unsigned.hpp"
+#include "montgomery.hpp"
+#include "simd_bits.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 /**
  * \file fibonacci.hpp
- * \brief File defines an algorithm for Fibonacci sequence generation. The algorithm is based on
- * linear algebra and has O(log N) complexity.
+ * \brief File defines algorithms for Fibonacci sequence generation. The algorithms are based on
+ * linear algebra and have O(log N) complexity: powers of the 2x2 Fibonacci matrix and the fast
+ * doubling identities derived from them.
  */
 
 namespace clsc {
@@ -46,12 +59,17 @@ namespace detail {
 struct Matrix2x2 {
     std::uint64_t elements[2 * 2] = {};
 
-    std::uint64_t e11() const { return elements[0]; }
-    std::uint64_t e12() const { return elements[1]; }
-    std::uint64_t e21() const { return elements[2]; }
-    std::uint64_t e22() const { return elements[3]; }
+    constexpr std::uint64_t e11() const { return elements[0]; }
+    constexpr std::uint64_t e12() const { return elements[1]; }
+    constexpr std::uint64_t e21() const { return elements[2]; }
+    constexpr std::uint64_t e22() const { return elements[3]; }
 
-    friend Matrix2x2 operator*(const Matrix2x2& a, const Matrix2x2& b) {
+    friend constexpr bool operator==(const Matrix2x2& a, const Matrix2x2& b) {
+        return a.e11() == b.e11() && a.e12() == b.e12() && a.e21() == b.e21() && a.e22() == b.e22();
+    }
+    friend constexpr bool operator!=(const Matrix2x2& a, const Matrix2x2& b) { return !(a == b); }
+
+    friend constexpr Matrix2x2 operator*(const Matrix2x2& a, const Matrix2x2& b) {
         const std::uint64_t e11 = a.e11() * b.e11() + a.e12() * b.e21();
         const std::uint64_t e12 = a.e11() * b.e12() + a.e12() * b.e22();
         const std::uint64_t e21 = a.e21() * b.e11() + a.e22() * b.e21();
@@ -64,19 +82,131 @@ struct Vector2 {
     std::uint64_t elements[2] = {0, 0};
 
     // square matrix multiplied by column vector.
-    friend Vector2 operator*(const Matrix2x2& m, const Vector2& v) {
+    friend constexpr Vector2 operator*(const Matrix2x2& m, const Vector2& v) {
         const std::uint64_t e11 = m.e11() * v.elements[0] + m.e12() * v.elements[1];
         const std::uint64_t e21 = m.e21() * v.elements[0] + m.e22() * v.elements[1];
         return {e11, e21};
     }
 };
 
-Matrix2x2 identity_element(std::multiplies<Matrix2x2>) { return {1, 0, 0, 1}; }
+constexpr Matrix2x2 identity_element(std::multiplies<Matrix2x2>) { return {1, 0, 0, 1}; }
+
+// arithmetic modulo 2^64
+struct fibonacci_wrapping_ring {
+    constexpr std::uint64_t zero() const { return 0; }
+    constexpr std::uint64_t one() const { return 1; }
+    constexpr std::uint64_t add(std::uint64_t a, std::uint64_t b) const { return a + b; }
+    constexpr std::uint64_t sub(std::uint64_t a, std::uint64_t b) const { return a - b; }
+    constexpr std::uint64_t mul(std::uint64_t a, std::uint64_t b) const { return a * b; }
+    constexpr std::uint64_t value(std::uint64_t a) const { return a; }
+};
+
+// residues modulo any m, products are reduced by division
+struct fibonacci_modular_ring {
+    std::uint64_t m;
+
+    constexpr std::uint64_t zero() const { return 0; }
+    constexpr std::uint64_t one() const { return 1 % m; }
+    constexpr std::uint64_t add(std::uint64_t a, std::uint64_t b) const {
+        // a + b may wrap around 2^64 when m is close to it
+        const std::uint64_t sum = a + b;
+        return sum < a || sum >= m ? sum - m : sum;
+    }
+    constexpr std::uint64_t sub(std::uint64_t a, std::uint64_t b) const {
+        return a >= b ? a - b : a - b + m;
+    }
+    constexpr std::uint64_t mul(std::uint64_t a, std::uint64_t b) const {
+        // a 64-bit division is several times cheaper than a 128-bit one
+        if (m <= (std::uint64_t(1) << 32)) {
+            return a * b % m;
+        }
+        using Wide = montgomery_wide<std::uint64_t>::type;
+        return std::uint64_t(Wide(a) * b % m);
+    }
+    constexpr std::uint64_t value(std::uint64_t a) const { return a; }
+};
+
+// residues modulo an odd m in Montgomery form, no division in products
+struct fibonacci_montgomery_ring : fibonacci_modular_ring {
+    montgomery_multiplies<std::uint64_t> op;
+
+    explicit constexpr fibonacci_montgomery_ring(std::uint64_t modulus)
+        : fibonacci_modular_ring{modulus}, op(modulus) {}
+
+    constexpr std::uint64_t one() const { return identity_element(op); }
+    constexpr std::uint64_t mul(std::uint64_t a, std::uint64_t b) const { return op(a, b); }
+    constexpr std::uint64_t value(std::uint64_t a) const { return op.from_montgomery(a); }
+};
+
+// F(n) by fast doubling: with (a, b) = (F(k), F(k + 1)),
+//   F(2k) = a * (2b - a), F(2k + 1) = a^2 + b^2,
+// which is the squaring of the Fibonacci matrix with its redundant entries dropped: 3 products
+// per bit of \a n instead of 8 (plus 8 more for every set bit)
+template<typename Ring> constexpr std::uint64_t fibonacci_doubling(std::uint64_t n, const Ring& r) {
+    std::uint64_t a = r.zero();
+    std::uint64_t b = r.one();
+    for (int bit = highest_bit(n); bit >= 0; --bit) {
+        const std::uint64_t even = r.mul(a, r.sub(r.add(b, b), a));
+        const std::uint64_t odd = r.add(r.mul(a, a), r.mul(b, b));
+        // bits of a random n are unpredictable, so the step is selected with a mask
+        const std::uint64_t mask = std::uint64_t(0) - ((n >> bit) & 1u);
+        a = even ^ ((even ^ odd) & mask);
+        b = r.add(odd, even & mask);
+    }
+    return r.value(a);
+}
+
+// F(0), ..., F(93): every Fibonacci number that fits into std::uint64_t
+constexpr std::size_t fibonacci_table_size = 94;
+
+constexpr std::array<std::uint64_t, fibonacci_table_size> make_fibonacci_table() {
+    std::array<std::uint64_t, fibonacci_table_size> table = {};
+    table[1] = 1;
+    for (std::size_t i = 2; i < table.size(); ++i) {
+        table[i] = table[i - 1] + table[i - 2];
+    }
+    return table;
+}
+
+constexpr std::array<std::uint64_t, fibonacci_table_size> fibonacci_table = make_fibonacci_table();
+
+// queries evaluated side by side, enough independent products to keep the multiplier busy while
+// the lanes still fit into general-purpose registers
+constexpr std::size_t fibonacci_batch_lanes = 4;
+
+// leading bits of an index that are looked up in fibonacci_table instead of doubled: the prefix
+// k is below 64, so F(k + 1) is still in the table
+constexpr int fibonacci_table_bits = 6;
 
+constexpr int bit_length(std::uint64_t n) { return n == 0 ? 0 : 64 - __builtin_clzll(n); }
+
+// F(n[i]) modulo 2^64 for indices of the same bit length \a bits > fibonacci_table_bits, fast
+// doubling in lockstep: every lane runs the same steps and selects its branch with a mask. The
+// remaining bits of every index are shifted to the top, so the mask is a sign extension
+template<std::size_t... I>
+void fibonacci_doubling_lanes(const std::uint64_t* n, std::uint64_t* out, int bits,
+                              std::index_sequence<I...>) {
+    const int low_bits = bits - fibonacci_table_bits;
+    std::uint64_t a[] = {fibonacci_table[n[I] >> low_bits]...};
+    std::uint64_t b[] = {fibonacci_table[(n[I] >> low_bits) + 1]...};
+    std::uint64_t rest[] = {(n[I] << (64 - low_bits))...};
+    for (int step = 0; step < low_bits; ++step) {
+        const std::uint64_t even[] = {(a[I] * (b[I] + b[I] - a[I]))...};
+        const std::uint64_t odd[] = {(a[I] * a[I] + b[I] * b[I])...};
+        const std::uint64_t mask[] = {std::uint64_t(std::int64_t(rest[I]) >> 63)...};
+        ((rest[I] <<= 1), ...);
+        ((a[I] = even[I] ^ ((even[I] ^ odd[I]) & mask[I])), ...);
+        ((b[I] = odd[I] + (even[I] & mask[I])), ...);
+    }
+    ((out[I] = a[I]), ...);
+}
 }  // namespace detail
 
-std::uint64_t fibonacci(std::uint32_t n) {
-    assert(n >= 0);
+/*! \brief Returns F(n) modulo 2^64 by powering the 2x2 Fibonacci matrix.
+ *
+ *  Kept as the reference for fibonacci(), which computes the same values with fewer products.
+ */
+constexpr std::uint64_t fibonacci_matrix(std::uint32_t n) {
     if (n == 0)
         return 0;
     const detail::Vector2 initial_value{1, 0};  // first two elements of fibonacci sequence
@@ -86,4 +216,293 @@ std::uint64_t fibonacci(std::uint32_t n) {
     return result.elements[0];
 }
 
+/*! \brief Returns F(n) modulo 2^64 (exact for n <= 93) by fast doubling.
+ */
+constexpr std::uint64_t fibonacci(std::uint64_t n) {
+    return detail::fibonacci_doubling(n, detail::fibonacci_wrapping_ring{});
+}
+
+/*! \brief Returns F(n) mod \a m for any non-zero \a m.
+ *
+ *  Odd moduli use Montgomery products, even ones reduce products by division, in 64 bits for
+ *  m <= 2^32 and in 128 bits above. No intermediate value overflows, so \a m may be as large as
+ *  2^64 - 1.
+ */
+constexpr std::uint64_t fibonacci_mod(std::uint64_t n, std::uint64_t m) {
+    assert(m > 0);
+    if (m % 2 == 1) {
+        return detail::fibonacci_doubling(n, detail::fibonacci_montgomery_ring(m));
+    }
+    return detail::fibonacci_doubling(n, detail::fibonacci_modular_ring{m});
+}
+
+namespace detail {
+// queries sorted and evaluated at a time, few enough for all buffers to stay in cache
+constexpr std::size_t fibonacci_batch_chunk = 4096;
+
+// results[i] = F(ns[i]) for i < count, \a sorted and \a order are scratch buffers of count
+// elements
+inline void fibonacci_batch_sorted(const std::uint64_t* ns, std::size_t count,
+                                   std::uint64_t* results, std::uint64_t* sorted,
+                                   std::size_t* order) {
+    constexpr std::size_t lanes = fibonacci_batch_lanes;
+    // bucket boundaries of the large indices by bit length
+    std::array<std::size_t, 66> offsets = {};
+    for (std::size_t i = 0; i < count; ++i) {
+        if (ns[i] < fibonacci_table_size) {
+            results[i] = fibonacci_table[ns[i]];
+        } else {
+            ++offsets[bit_length(ns[i]) + 1];
+        }
+    }
+    for (std::size_t bits = 1; bits < offsets.size(); ++bits) {
+        offsets[bits] += offsets[bits - 1];
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        if (ns[i] >= fibonacci_table_size) {
+            const std::size_t position = offsets[bit_length(ns[i])]++;
+            order[position] = i;
+            sorted[position] = ns[i];
+        }
+    }
+
+    // after the scatter offsets[bits] is the end of the bucket of that bit length
+    std::size_t begin = 0;
+    for (int bits = 0; bits <= 64; begin = offsets[bits++]) {
+        for (std::size_t i = begin; i < offsets[bits]; i += lanes) {
+            const std::uint64_t* n = sorted + i;
+            const std::size_t group = std::min(lanes, offsets[bits] - i);
+            std::uint64_t padded[lanes];
+            if (group < lanes) {
+                // the last group of a bucket is padded with its first index
+                std::fill(std::copy(n, n + group, padded), padded + lanes, n[0]);
+                n = padded;
+            }
+            std::uint64_t f[lanes];
+            fibonacci_doubling_lanes(n, f, bits, std::make_index_sequence<lanes>{});
+            for (std::size_t j = 0; j < group; ++j) {
+                results[order[i + j]] = f[j];
+            }
+        }
+    }
+}
+}  // namespace detail
+
+/*! \brief Stores fibonacci(n) for every non-negative index n in [first, last) into the range
+ *         starting at \a d_first and returns the end of that range.
+ *
+ *  Indices up to 93 are looked up in a table. Larger ones are counting-sorted by bit length in
+ *  chunks of detail::fibonacci_batch_chunk queries, so that groups of
+ *  detail::fibonacci_batch_lanes queries run the same number of fast doubling steps in
+ *  lockstep, starting from the table value of their leading bits. The lanes are independent
+ *  products, which the processor overlaps (or, with a 64-bit vector multiply such as
+ *  AVX-512DQ, the compiler vectorizes) instead of waiting on one query at a time.
+ */
+template<typename InputIt, typename OutputIt>
+OutputIt fibonacci_batch(InputIt first, InputIt last, OutputIt d_first) {
+    constexpr std::size_t chunk = detail::fibonacci_batch_chunk;
+    std::vector<std::uint64_t> buffer(3 * chunk);
+    std::vector<std::size_t> order(chunk);
+    std::uint64_t* const ns = buffer.data();
+    std::uint64_t* const results = ns + chunk;
+    while (first != last) {
+        std::size_t count = 0;
+        for (; count < chunk && first != last; ++count, ++first) {
+            ns[count] = std::uint64_t(*first);
+        }
+        detail::fibonacci_batch_sorted(ns, count, results, results + chunk, order.data());
+        d_first = std::copy(results, results + count, d_first);
+    }
+    return d_first;
+}
+
+namespace detail {
+// (F(n), F(n + 1)) modulo 2^64 from the n-th power of the Fibonacci matrix
+inline std::pair<std::uint64_t, std::uint64_t> fibonacci_pair(std::uint64_t n) {
+    const Matrix2x2 power = power_monoid(Matrix2x2{1, 1, 1, 0}, n, std::multiplies<Matrix2x2>{});
+    return {power.e12(), power.e11()};
+}
+
+// consecutive vectors of values written per step of the vector kernel
+constexpr std::size_t fibonacci_fill_vectors = 2;
+
+#if defined(CLSC_VECTOR_EXTENSIONS)
+constexpr std::uint64_t lucas_number(std::size_t k) {
+    std::uint64_t a = 2;
+    std::uint64_t b = 1;
+    for (std::size_t i = 0; i < k; ++i) {
+        const std::uint64_t c = a + b;
+        a = b;
+        b = c;
+    }
+    return a;
+}
+
+// writes F(a), ..., F(a + count - 1) to out. Vector t holds the stride consecutive values that
+// start stride * t positions ahead; with S = stride * vectors the identity
+//   F(n + 2S) = L(S) F(n + S) - (-1)^S F(n)
+// advances every vector by S positions with one product by the Lucas number L(S), so the vectors
+// form independent chains that step without any cross-lane work
+inline void fibonacci_fill_simd(std::uint64_t* out, std::uint64_t a, std::size_t count) {
+    constexpr std::size_t lanes = simd_lanes<std::uint64_t>;
+    constexpr std::size_t vectors = fibonacci_fill_vectors;
+    constexpr std::size_t stride = lanes * vectors;
+    constexpr std::uint64_t lucas = lucas_number(stride);
+
+    // the first two strides are stepped one by one from the seek
+    std::uint64_t values[2 * stride];
+    std::pair<std::uint64_t, std::uint64_t> f = fibonacci_pair(a);
+    for (auto& value : values) {
+        value = f.first;
+        f = {f.second, f.first + f.second};
+    }
+    simd_vector<std::uint64_t> v[2 * vectors];
+    for (std::size_t t = 0; t < 2 * vectors; ++t) {
+        v[t] = simd_load(values + t * lanes);
+    }
+    std::size_t i = 0;
+    for (; count - i >= stride; i += stride) {
+        for (std::size_t t = 0; t < vectors; ++t) {
+            simd_store(out + i + t * lanes, v[t]);
+            const auto next = v[vectors + t] * lucas + (stride % 2 == 1 ? v[t] : -v[t]);
+            v[t] = v[vectors + t];
+            v[vectors + t] = next;
+        }
+    }
+    for (std::size_t t = 0; t < 2 * vectors; ++t) {
+        simd_store(values + t * lanes, v[t]);
+    }
+    std::copy(values, values + (count - i), out + i);
+}
+#endif
+}  // namespace detail
+
+/*! \brief Writes F(a), F(a + 1), ..., F(a + count - 1) modulo 2^64 to the range starting at
+ *         \a out and returns the end of that range.
+ *
+ *  The range seeks to \a a once with a power of the Fibonacci matrix and then steps linearly,
+ *  O(1) per element. Contiguous output is filled by a vector kernel whose lanes run staggered
+ *  chains of the sequence, so that large buffers are limited by memory bandwidth rather than by
+ *  the latency of the additions.
+ */
+template<typename OutputIt>
+OutputIt fibonacci_fill(OutputIt out, std::uint64_t a, std::size_t count) {
+#if defined(CLSC_VECTOR_EXTENSIONS)
+    if constexpr (detail::is_contiguous_iterator_v<OutputIt>) {
+        using value_type = typename std::iterator_traits<OutputIt>::value_type;
+        if constexpr (std::is_same<value_type, std::uint64_t>::value) {
+            if (count >= 2 * detail::simd_lanes<std::uint64_t> * detail::fibonacci_fill_vectors) {
+                detail::fibonacci_fill_simd(&*out, a, count);
+                return out + count;
+            }
+        }
+    }
+#endif
+    std::pair<std::uint64_t, std::uint64_t> f = detail::fibonacci_pair(a);
+    for (std::size_t i = 0; i < count; ++i, ++out) {
+        *out = f.first;
+        f = {f.second, f.first + f.second};
+    }
+    return out;
+}
+
+/*! \brief Range of F(a), F(a + 1), ..., F(b) modulo 2^64, both ends included.
+ *
+ *  begin() seeks to \a a with a power of the Fibonacci matrix, every increment is one addition.
+ */
+class fibonacci_range_view {
+    std::uint64_t m_first = 0;
+    std::uint64_t m_last = 0;  // one past b
+
+public:
+    class iterator {
+        std::uint64_t m_index = 0;
+        std::uint64_t m_current = 0;
+        std::uint64_t m_next = 1;
+
+        friend class fibonacci_range_view;
+        explicit iterator(std::uint64_t index) : m_index(index) {}
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::uint64_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::uint64_t*;
+        using reference = const std::uint64_t&;
+
+        iterator() = default;
+
+        reference operator*() const { return m_current; }
+        pointer operator->() const { return &m_current; }
+
+        iterator& operator++() {
+            const std::uint64_t next = m_current + m_next;
+            m_current = m_next;
+            m_next = next;
+            ++m_index;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        // index of the current element
+        std::uint64_t index() const { return m_index; }
+
+        friend bool operator==(const iterator& x, const iterator& y) {
+            return x.m_index == y.m_index;
+        }
+        friend bool operator!=(const iterator& x, const iterator& y) { return !(x == y); }
+    };
+
+    fibonacci_range_view(std::uint64_t a, std::uint64_t b) : m_first(a), m_last(b + 1) {
+        assert(a <= b + 1 && b + 1 != 0);
+    }
+
+    iterator begin() const {
+        iterator it(m_first);
+        std::tie(it.m_current, it.m_next) = detail::fibonacci_pair(m_first);
+        return it;
+    }
+    iterator end() const { return iterator(m_last); }
+
+    std::size_t size() const { return std::size_t(m_last - m_first); }
+    bool empty() const { return m_first == m_last; }
+};
+
+/*! \brief Returns the view of F(a), ..., F(b).
+ */
+inline fibonacci_range_view fibonacci_range(std::uint64_t a, std::uint64_t b) {
+    return fibonacci_range_view(a, b);
+}
+
+/*! \brief Returns F(n) exactly.
+ *
+ *  Fast doubling with big_unsigned values: every step squares or multiplies numbers of about
+ *  0.69 * k bits for F(k), so the cost is dominated by the last few steps and stays within a
+ *  small factor of one product of F(n)-sized numbers. The last step computes only F(n).
+ */
+inline big_unsigned fibonacci_big(std::uint64_t n) {
+    // (a, b) = (F(k), F(k + 1)), k is the prefix of n scanned so far
+    big_unsigned a;
+    big_unsigned b(1);
+    for (int bit = detail::highest_bit(n); bit > 0; --bit) {
+        big_unsigned even = a * (b + b - a);
+        big_unsigned odd = a * a + b * b;
+        if ((n >> bit) & 1u) {
+            a = std::move(odd);
+            b = a + even;
+        } else {
+            a = std::move(even);
+            b = std::move(odd);
+        }
+    }
+    if (n & 1u) {
+        return a * a + b * b;
+    }
+    return n == 0 ? a : a * (b + b - a);
+}
+
 }  // namespace clsc
@@ -0,0 +1,396 @@
+// Copyright 2021 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include "fibonacci.hpp"
+#include "montgomery.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * \file fibonacci_mod_cache.hpp
+ * \brief File defines Pisano periods (periods of Fibonacci numbers modulo m) and a cache that
+ * answers F(n) mod m queries for recurring moduli from per-modulus tables of one period.
+ */
+namespace clsc {
+
+namespace detail {
+using pisano_wide = unsigned __int128;
+
+// deterministic Miller-Rabin test for 64-bit numbers
+inline bool is_prime_u64(std::uint64_t n) {
+    if (n < 2) {
+        return false;
+    }
+    for (std::uint64_t p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37}) {
+        if (n % p == 0) {
+            return n == p;
+        }
+    }
+    const montgomery_multiplies<std::uint64_t> op(n);
+    const std::uint64_t one = identity_element(op);
+    const std::uint64_t minus_one = n - one;
+    int s = 0;
+    std::uint64_t d = n - 1;
+    for (; d % 2 == 0; d /= 2) {
+        ++s;
+    }
+    // these bases are sufficient for all n < 2^64
+    for (std::uint64_t a : {2, 325, 9375, 28178, 450775, 9780504, 1795265022}) {
+        std::uint64_t x = power_monoid(op.to_montgomery(a), d, op);
+        if (x == 0 || x == one || x == minus_one) {
+            continue;
+        }
+        bool composite = true;
+        for (int i = 1; i < s && composite; ++i) {
+            x = op(x, x);
+            composite = x != minus_one;
+        }
+        if (composite) {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr std::uint64_t gcd_u64(std::uint64_t a, std::uint64_t b) {
+    while (b != 0) {
+        a %= b;
+        std::swap(a, b);
+    }
+    return a;
+}
+
+// a non-trivial factor of an odd composite \a n by Brent's variant of Pollard's rho
+inline std::uint64_t pollard_rho(std::uint64_t n) {
+    const montgomery_multiplies<std::uint64_t> op(n);
+    // differences are multiplied together and checked with one gcd per batch
+    constexpr std::uint64_t batch = 128;
+    for (std::uint64_t c = 1;; ++c) {
+        const auto f = [&](std::uint64_t x) {
+            const std::uint64_t y = op(x, x) + c;
+            return y >= n ? y - n : y;
+        };
+        std::uint64_t x = 0;
+        std::uint64_t y = 2;
+        std::uint64_t saved = y;
+        std::uint64_t product = identity_element(op);
+        std::uint64_t g = 1;
+        for (std::uint64_t length = 1; g == 1; length *= 2) {
+            x = y;
+            for (std::uint64_t i = 0; i < length; ++i) {
+                y = f(y);
+            }
+            for (std::uint64_t k = 0; k < length && g == 1; k += batch) {
+                saved = y;
+                for (std::uint64_t i = 0; i < batch && i < length - k; ++i) {
+                    y = f(y);
+                    product = op(product, x > y ? x - y : y - x);
+                }
+                g = gcd_u64(product, n);
+            }
+        }
+        if (g == n) {
+            // the batch overshot: repeat its steps one at a time
+            do {
+                saved = f(saved);
+                g = gcd_u64(x > saved ? x - saved : saved - x, n);
+            } while (g == 1);
+        }
+        if (g != n) {
+            return g;
+        }
+    }
+}
+
+inline void factorize_into(std::uint64_t n, std::vector<std::uint64_t>& primes) {
+    if (n == 1) {
+        return;
+    }
+    if (is_prime_u64(n)) {
+        primes.push_back(n);
+        return;
+    }
+    const std::uint64_t d = pollard_rho(n);
+    factorize_into(d, primes);
+    factorize_into(n / d, primes);
+}
+
+// prime factorization of \a n as (prime, exponent) pairs in increasing order of primes
+inline std::vector<std::pair<std::uint64_t, int>> factorize(std::uint64_t n) {
+    assert(n > 0);
+    std::vector<std::uint64_t> primes;
+    // small factors by trial division, the rest by Pollard's rho on odd numbers
+    for (std::uint64_t p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37}) {
+        for (; n % p == 0; n /= p) {
+            primes.push_back(p);
+        }
+    }
+    factorize_into(n, primes);
+    std::sort(primes.begin(), primes.end());
+    std::vector<std::pair<std::uint64_t, int>> factors;
+    for (std::uint64_t p : primes) {
+        if (!factors.empty() && factors.back().first == p) {
+            ++factors.back().second;
+        } else {
+            factors.emplace_back(p, 1);
+        }
+    }
+    return factors;
+}
+
+// pi(p) for a prime p: the order of the Fibonacci matrix modulo p divides p - 1 when p = +-1
+// (mod 5) and divides 2 (p + 1) when p = +-2 (mod 5); the divisor is found by removing prime
+// factors while F(k) = 0 and F(k + 1) = 1 (mod p) still hold
+inline pisano_wide pisano_period_prime(std::uint64_t p) {
+    if (p == 2) {
+        return 3;
+    }
+    if (p == 5) {
+        return 20;
+    }
+    const bool split = p % 5 == 1 || p % 5 == 4;
+    // 2 (p + 1) may not fit into 64 bits, so it is kept factored
+    std::vector<std::pair<std::uint64_t, int>> factors = factorize(split ? p - 1 : p / 2 + 1);
+    if (!split) {
+        // p / 2 + 1 = (p + 1) / 2, so 2 (p + 1) = 4 (p / 2 + 1)
+        if (factors.empty() || factors.front().first != 2) {
+            factors.insert(factors.begin(), {2, 0});
+        }
+        factors.front().second += 2;
+    }
+    pisano_wide period = 1;
+    for (const auto& factor : factors) {
+        for (int i = 0; i < factor.second; ++i) {
+            period *= factor.first;
+        }
+    }
+    for (const auto& factor : factors) {
+        for (int i = 0; i < factor.second; ++i) {
+            const pisano_wide k = period / factor.first;
+            assert(k <= std::numeric_limits<std::uint64_t>::max());
+            if (fibonacci_mod(std::uint64_t(k), p) != 0 ||
+                fibonacci_mod(std::uint64_t(k) + 1, p) != 1) {
+                break;
+            }
+            period = k;
+        }
+    }
+    return period;
+}
+
+// pi(m) = lcm of pi(p^e) = pi(p) p^(e - 1) over the prime powers of m, saturated at 2^64
+inline pisano_wide pisano_period_wide(std::uint64_t m) {
+    constexpr pisano_wide limit = pisano_wide(1) << 64;
+    pisano_wide period = 1;
+    for (const auto& factor : factorize(m)) {
+        pisano_wide pi = pisano_period_prime(factor.first);
+        for (int i = 1; i < factor.second && pi < limit; ++i) {
+            pi *= factor.first;
+        }
+        pi = std::min(pi, limit);
+        pisano_wide a = period;
+        pisano_wide b = pi;
+        while (b != 0) {
+            a %= b;
+            std::swap(a, b);
+        }
+        period = period / a > limit / pi ? limit : period / a * pi;
+    }
+    return period;
+}
+}  // namespace detail
+
+/*! \brief Returns the Pisano period pi(m), the period of F(n) mod \a m, or 0 when it does not
+ *         fit into 64 bits (pi(m) <= 6m, so only for m above 2^61).
+ *
+ *  \a m is factored with Pollard's rho, pi(m) is the least common multiple of the periods of
+ *  its prime powers, pi(p^e) = pi(p) p^(e - 1).
+ */
+inline std::uint64_t pisano_period(std::uint64_t m) {
+    assert(m > 0);
+    const detail::pisano_wide period = detail::pisano_period_wide(m);
+    return period > std::numeric_limits<std::uint64_t>::max() ? 0 : std::uint64_t(period);
+}
+
+/*! \brief Cache of Fibonacci numbers modulo recurring moduli.
+ *
+ *  The first query for a modulus m computes pi(m). When one period of F(i) mod m fits into the
+ *  memory budget, it is tabulated and every further query is a lookup of F(n mod pi(m));
+ *  otherwise queries reduce n modulo pi(m) and evaluate fibonacci_mod. The least recently used
+ *  moduli are evicted to keep the tables and the bookkeeping within the budget.
+ *
+ *  Queries may be issued from any number of threads: lookups share a reader lock, entries are
+ *  immutable once published, and only inserting a new modulus takes the exclusive lock. Two
+ *  threads that miss on the same modulus at the same time both compute it, one result is kept.
+ */
+class fibonacci_mod_cache {
+    struct entry {
+        std::uint64_t period = 0;          // 0 when pi(m) does not fit into 64 bits
+        std::vector<std::uint32_t> table;  // F(0), ..., F(period - 1) mod m, or empty
+        // value of the clock when the entry was last used
+        mutable std::atomic<std::uint64_t> last_used{0};
+    };
+
+    std::size_t m_budget = 0;
+    std::size_t m_used = 0;
+    // advanced by every insertion and by the first hit on an entry after an insertion: recency is
+    // only compared when an insertion evicts, so later hits in the same epoch change nothing and
+    // do not have to write shared counters
+    std::atomic<std::uint64_t> m_clock{0};
+    std::atomic<std::uint64_t> m_last_insertion{0};  // clock value of the newest entry
+    mutable std::shared_mutex m_mutex;
+    std::unordered_map<std::uint64_t, std::shared_ptr<const entry>> m_entries;
+
+    // memory charged for an entry, including an estimate of the hash map node
+    static std::size_t entry_bytes(const entry& e) {
+        return sizeof(entry) + 4 * sizeof(void*) + e.table.size() * sizeof(std::uint32_t);
+    }
+
+    std::shared_ptr<const entry> make_entry(std::uint64_t m) const {
+        auto e = std::make_shared<entry>();
+        e->period = pisano_period(m);
+        // tables hold 32-bit residues and must fit into the whole budget on their own
+        const bool fits = e->period != 0 && m <= (std::uint64_t(1) << 32) &&
+                          e->period <= (m_budget - std::min(m_budget, entry_bytes(*e))) /
+                                           sizeof(std::uint32_t);
+        if (fits) {
+            e->table.resize(e->period);
+            std::uint64_t a = 0;
+            std::uint64_t b = 1 % m;
+            for (auto& value : e->table) {
+                value = std::uint32_t(a);
+                const std::uint64_t sum = a + b;
+                a = b;
+                b = sum >= m ? sum - m : sum;
+            }
+        }
+        return e;
+    }
+
+    std::shared_ptr<const entry> find(std::uint64_t m) {
+        {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            const auto it = m_entries.find(m);
+            if (it != m_entries.end()) {
+                // stores only on the first hit after an insertion, and then ranks strictly above
+                // that insertion
+                auto& last_used = it->second->last_used;
+                if (last_used.load(std::memory_order_relaxed) <
+                    m_last_insertion.load(std::memory_order_relaxed)) {
+                    last_used.store(m_clock.fetch_add(1, std::memory_order_relaxed) + 1,
+                                    std::memory_order_relaxed);
+                }
+                return it->second;
+            }
+        }
+        const std::shared_ptr<const entry> e = make_entry(m);
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        const auto inserted = m_entries.emplace(m, e);
+        if (!inserted.second) {
+            return inserted.first->second;
+        }
+        const std::uint64_t now = m_clock.fetch_add(1, std::memory_order_relaxed) + 1;
+        e->last_used.store(now, std::memory_order_relaxed);
+        m_last_insertion.store(now, std::memory_order_relaxed);
+        m_used += entry_bytes(*e);
+        while (m_used > m_budget && m_entries.size() > 1) {
+            auto victim = m_entries.end();
+            for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+                if (it->second != e &&
+                    (victim == m_entries.end() ||
+                     it->second->last_used.load(std::memory_order_relaxed) <
+                         victim->second->last_used.load(std::memory_order_relaxed))) {
+                    victim = it;
+                }
+            }
+            m_used -= entry_bytes(*victim->second);
+            m_entries.erase(victim);
+        }
+        return e;
+    }
+
+public:
+    /*! \brief Creates a cache that takes at most \a budget bytes for its moduli in total.
+     */
+    explicit fibonacci_mod_cache(std::size_t budget = std::size_t(64) << 20) : m_budget(budget) {}
+
+    fibonacci_mod_cache(const fibonacci_mod_cache&) = delete;
+    fibonacci_mod_cache& operator=(const fibonacci_mod_cache&) = delete;
+
+    /*! \brief Returns F(n) mod \a m.
+     */
+    std::uint64_t operator()(std::uint64_t n, std::uint64_t m) {
+        assert(m > 0);
+        const std::shared_ptr<const entry> e = find(m);
+        if (e->period != 0) {
+            n %= e->period;
+        }
+        if (!e->table.empty()) {
+            return e->table[n];
+        }
+        return fibonacci_mod(n, m);
+    }
+
+    /*! \brief Returns pisano_period(m), cached like the tables.
+     */
+    std::uint64_t period(std::uint64_t m) { return find(m)->period; }
+
+    std::size_t budget() const { return m_budget; }
+
+    // bytes charged for the cached moduli, never above budget() unless a single modulus is
+    std::size_t memory_usage() const {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return m_used;
+    }
+
+    std::size_t size() const {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return m_entries.size();
+    }
+
+    // true if \a m is cached with a table of one period
+    bool tabulated(std::uint64_t m) const {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        const auto it = m_entries.find(m);
+        return it != m_entries.end() && !it->second->table.empty();
+    }
+};
+
+}  // namespace clsc
@@ -0,0 +1,142 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include "algorithm.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+/**
+ * \file fixed_base_power.hpp
+ * \brief File defines fixed-base exponentiation. Powers of a single base are precomputed once, so
+ * that every subsequent exponent is served without squarings.
+ */
+namespace clsc {
+
+/*! \brief Precomputed power table of a fixed base under a monoid operation.
+ *
+ *  The table holds a^(d * 2^(w * j)) for every window position j and every non-zero w-bit digit
+ *  d, where w is the window width. Raising the base to n then costs one \a op per non-zero w-bit
+ *  digit of n (about popcount(n) operations for w == 1) and no squarings at all. Exponents wider
+ *  than \a max_exponent_bits bits given on construction are still served: the bits beyond the
+ *  table raise a^(2^max_exponent_bits) with power_semigroup.
+ */
+template<typename Regular, typename MonoidOperation> class fixed_base_power {
+    MonoidOperation m_op;
+    std::size_t m_window = 1;
+    std::size_t m_row = 1;         // entries per window position: 2^w - 1
+    std::size_t m_positions = 0;   // number of window positions covered by the table
+    std::vector<Regular> m_table;  // m_positions rows, m_row entries each
+    Regular m_top;                 // a^(2^(w * m_positions)), base of the bits beyond the table
+
+    template<typename Integer> std::size_t next_digit(Integer& n) const {
+        if constexpr (std::is_integral<Integer>::value) {
+            // avoid a data-dependent branch per exponent bit for built-in integers
+            const std::size_t digit = std::size_t(n) & m_row;
+            n >>= m_window;
+            return digit;
+        }
+        using clsc::detail::half;
+        using clsc::detail::odd;
+        std::size_t digit = 0;
+        for (std::size_t i = 0; i < m_window && n != Integer(0); ++i) {
+            if (odd(n)) {
+                digit |= std::size_t(1) << i;
+            }
+            n = half(n);
+        }
+        return digit;
+    }
+
+    const Regular& entry(std::size_t position, std::size_t digit) const {
+        return m_table[position * m_row + digit - 1];
+    }
+
+    // a^(n * 2^(w * m_positions)) for the exponent bits \a n > 0 left beyond the table
+    template<typename Integer> Regular beyond_table(Integer n) const {
+        return power_semigroup(m_top, n, m_op);
+    }
+
+public:
+    fixed_base_power(Regular a, MonoidOperation op, std::size_t max_exponent_bits = 64,
+                     std::size_t window_bits = 1)
+        : m_op(op), m_window(window_bits), m_row((std::size_t(1) << window_bits) - 1),
+          m_positions((max_exponent_bits + window_bits - 1) / window_bits), m_top(a) {
+        assert(window_bits > 0 && window_bits < 16);
+        m_table.reserve(m_positions * m_row);
+        for (std::size_t j = 0; j < m_positions; ++j) {
+            // a holds a^(2^(w * j)) here, the row is its 1st .. (2^w - 1)th powers
+            m_table.push_back(a);
+            for (std::size_t d = 1; d < m_row; ++d) {
+                m_table.push_back(m_op(m_table.back(), a));
+            }
+            a = m_op(m_table.back(), a);
+        }
+        m_top = a;
+    }
+
+    std::size_t max_exponent_bits() const { return m_positions * m_window; }
+    std::size_t window_bits() const { return m_window; }
+
+    template<typename Integer> Regular operator()(Integer n) const {
+        assert(n >= 0);
+        std::size_t position = 0;
+        std::size_t digit = 0;
+        while (n != Integer(0) && position < m_positions) {
+            digit = next_digit(n);
+            if (digit != 0) {
+                break;
+            }
+            ++position;
+        }
+        if (digit == 0) {
+            if (n != Integer(0)) {
+                return beyond_table(n);
+            }
+            using clsc::detail::identity_element;
+            return identity_element(m_op);
+        }
+        Regular r = entry(position, digit);
+        while (n != Integer(0)) {
+            if (++position == m_positions) {
+                return m_op(r, beyond_table(n));
+            }
+            digit = next_digit(n);
+            if (digit != 0) {
+                r = m_op(r, entry(position, digit));
+            }
+        }
+        return r;
+    }
+};
+
+}  // namespace clsc
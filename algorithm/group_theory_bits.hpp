@@ -29,20 +29,107 @@
 #pragma once
 
 #include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
 
 namespace clsc {
+
+/*! \brief Binary minimum, an idempotent and commutative monoid operation.
+ */
+template<typename T> struct minimum {
+    constexpr const T& operator()(const T& a, const T& b) const { return b < a ? b : a; }
+};
+
+/*! \brief Binary maximum, an idempotent and commutative monoid operation.
+ */
+template<typename T> struct maximum {
+    constexpr const T& operator()(const T& a, const T& b) const { return a < b ? b : a; }
+};
+
+/*! \brief Algebraic properties of operations, to be specialized by users for their own ones.
+ *
+ *  is_commutative: op(a, b) == op(b, a), so operands may be reordered (e.g. reductions keep
+ *  several interleaved accumulators). is_idempotent: op(a, a) == a, so a^n == a for n > 0.
+ *  native_power: provides a static apply(a, n, op) that computes a^n directly, e.g. a * n for
+ *  std::plus of integers.
+ */
+template<typename Operation> struct is_commutative : std::false_type {};
+template<typename Operation> struct is_idempotent : std::false_type {};
+template<typename Operation> struct native_power {};
+
+template<typename Operation> constexpr bool is_commutative_v = is_commutative<Operation>::value;
+template<typename Operation> constexpr bool is_idempotent_v = is_idempotent<Operation>::value;
+
+template<typename T> struct is_commutative<std::plus<T>> : std::is_arithmetic<T> {};
+template<typename T> struct is_commutative<std::multiplies<T>> : std::is_arithmetic<T> {};
+template<typename T> struct is_commutative<std::bit_and<T>> : std::is_integral<T> {};
+template<typename T> struct is_commutative<std::bit_or<T>> : std::is_integral<T> {};
+template<typename T> struct is_commutative<std::bit_xor<T>> : std::is_integral<T> {};
+template<typename T> struct is_commutative<minimum<T>> : std::true_type {};
+template<typename T> struct is_commutative<maximum<T>> : std::true_type {};
+
+template<typename T> struct is_idempotent<std::bit_and<T>> : std::is_integral<T> {};
+template<typename T> struct is_idempotent<std::bit_or<T>> : std::is_integral<T> {};
+template<typename T> struct is_idempotent<minimum<T>> : std::true_type {};
+template<typename T> struct is_idempotent<maximum<T>> : std::true_type {};
+
+// n-fold sum of an integer is a single multiplication. it is done in an unsigned type of at least
+// the width of unsigned int, so the product wraps around instead of overflowing a signed or
+// promoted type, and converts back like repeated addition of two's complement values does.
+// floating point types keep repeated addition and its rounding
+template<typename T> struct native_power<std::plus<T>> {
+    template<typename Regular, typename Integer,
+             typename = std::enable_if_t<
+                 (std::is_void<T>::value || std::is_same<T, Regular>::value) &&
+                 std::is_integral<Regular>::value && !std::is_same<Regular, bool>::value &&
+                 std::is_integral<Integer>::value>>
+    static constexpr Regular apply(const Regular& a, Integer n, const std::plus<T>&) {
+        using promoted = std::make_unsigned_t<std::common_type_t<Regular, unsigned>>;
+        return Regular(promoted(a) * promoted(n));
+    }
+};
+
 namespace detail {
+// \c true if native_power<Operation>::apply(a, n, op) is available for these argument types
+template<typename Operation, typename Regular, typename Integer, typename = void>
+struct has_native_power : std::false_type {};
+template<typename Operation, typename Regular, typename Integer>
+struct has_native_power<Operation, Regular, Integer,
+                        std::void_t<decltype(native_power<Operation>::apply(
+                            std::declval<const Regular&>(), std::declval<Integer>(),
+                            std::declval<const Operation&>()))>> : std::true_type {};
+template<typename Operation, typename Regular, typename Integer>
+constexpr bool has_native_power_v = has_native_power<Operation, Regular, Integer>::value;
 
-template<typename Integer> bool odd(Integer x) { return bool(x & 0x1); }
+template<typename Integer> constexpr bool odd(Integer x) { return bool(x & 0x1); }
 
-template<typename Integer> Integer half(Integer x) { return x / 2; }
+template<typename Integer> constexpr Integer half(Integer x) { return x / 2; }
 
-template<typename Regular> Regular identity_element(std::plus<Regular>) { return Regular(0); }
-template<typename Regular> Regular identity_element(std::multiplies<Regular>) { return Regular(1); }
-template<typename Regular> std::negate<Regular> inverse_element(std::plus<Regular>) {
+template<typename Regular> constexpr Regular identity_element(std::plus<Regular>) {
+    return Regular(0);
+}
+template<typename Regular> constexpr Regular identity_element(std::multiplies<Regular>) {
+    return Regular(1);
+}
+template<typename Regular> constexpr Regular identity_element(minimum<Regular>) {
+    if constexpr (std::numeric_limits<Regular>::has_infinity) {
+        return std::numeric_limits<Regular>::infinity();
+    } else {
+        return std::numeric_limits<Regular>::max();
+    }
+}
+template<typename Regular> constexpr Regular identity_element(maximum<Regular>) {
+    if constexpr (std::numeric_limits<Regular>::has_infinity) {
+        return -std::numeric_limits<Regular>::infinity();
+    } else {
+        return std::numeric_limits<Regular>::lowest();
+    }
+}
+template<typename Regular> constexpr std::negate<Regular> inverse_element(std::plus<Regular>) {
     return std::negate<Regular>{};
 }
-template<typename Regular> decltype(auto) inverse_element(std::multiplies<Regular>) {
+template<typename Regular> constexpr decltype(auto) inverse_element(std::multiplies<Regular>) {
     return [](Regular x) {
         if (x == Regular(0)) {
             return x;
@@ -0,0 +1,379 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include "algorithm.hpp"
+#include "fixed_base_power.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file linear_recurrence.hpp
+ * \brief File defines the nth term of an order-k linear recurrence. The term is computed as
+ * x^n modulo the characteristic polynomial (Kitamasa method), an O(k^2 log n) alternative to
+ * powering the k x k companion matrix in O(k^3 log n).
+ */
+namespace clsc {
+
+namespace detail {
+// holds a product of two residues, modular arithmetic is available for the specialized types
+template<typename T> struct recurrence_wide { using type = T; };
+template<> struct recurrence_wide<std::uint32_t> { using type = std::uint64_t; };
+template<> struct recurrence_wide<std::uint64_t> { using type = unsigned __int128; };
+
+/*! \brief Multiplication of polynomials modulo a monic characteristic polynomial of degree k.
+ *
+ *  Elements are coefficient vectors of size k, lowest degree first. With a non-zero modulus
+ *  (std::uint32_t and std::uint64_t only) coefficients are residues; products are summed in a
+ *  double-width accumulator that is reduced only when it may overflow. With zero modulus the
+ *  arithmetic of \a T is used as is (e.g. wrapping unsigned integers). The operation owns
+ *  scratch space, so one object must not be used from several threads at once.
+ */
+template<typename T> class kitamasa_multiplies {
+    using Wide = typename recurrence_wide<T>::type;
+    static constexpr bool has_modular = !std::is_same<Wide, T>::value;
+
+    std::vector<T> m_low;  // x^k == sum m_low[q] * x^q
+    T m_modulus = T(0);
+    std::size_t m_lazy_rows = std::numeric_limits<std::size_t>::max();
+    mutable std::vector<Wide> m_wide;
+    mutable std::vector<T> m_native;
+
+    void flush(std::size_t count) const {
+        for (std::size_t q = 0; q < count; ++q) {
+            m_wide[q] %= m_modulus;
+        }
+    }
+
+    // accumulates the product of a and b into m_wide, returns the number of pending products
+    std::size_t convolve_modular(const std::vector<T>& a, const std::vector<T>& b) const {
+        const std::size_t k = m_low.size();
+        std::size_t rows = 0;
+        if (&a != &b) {
+            for (std::size_t i = 0; i < k; ++i) {
+                if (a[i] == T(0)) {
+                    continue;
+                }
+                const Wide ai = a[i];
+                Wide* row = m_wide.data() + i;
+                for (std::size_t j = 0; j < k; ++j) {
+                    row[j] += ai * b[j];
+                }
+                if (++rows == m_lazy_rows) {
+                    flush(2 * k - 1);
+                    rows = 0;
+                }
+            }
+            return rows;
+        }
+        // squaring: every off-diagonal product is computed once and doubled
+        for (std::size_t i = 0; i + 1 < k; ++i) {
+            if (a[i] == T(0)) {
+                continue;
+            }
+            const Wide ai = a[i];
+            Wide* row = m_wide.data() + 2 * i;
+            for (std::size_t j = i + 1; j < k; ++j) {
+                row[j - i] += ai * a[j];
+            }
+            if (++rows == m_lazy_rows) {
+                flush(2 * k - 1);
+                rows = 0;
+            }
+        }
+        flush(2 * k - 1);
+        for (std::size_t i = 0; i < k; ++i) {
+            // 2 * (m - 1) + (m - 1)^2 < m^2 still fits
+            m_wide[2 * i] = 2 * m_wide[2 * i] + Wide(a[i]) * a[i];
+            if (i + 1 < k) {
+                m_wide[2 * i + 1] *= 2;
+            }
+        }
+        flush(2 * k - 1);
+        return 0;
+    }
+
+    void multiply_modular(std::vector<T>& out, const std::vector<T>& a,
+                          const std::vector<T>& b) const {
+        const std::size_t k = m_low.size();
+        m_wide.assign(2 * k - 1, Wide(0));
+        std::size_t rows = convolve_modular(a, b);
+        // fold x^i = x^(i - k) * x^k from the top degree down
+        for (std::size_t i = 2 * k - 2; i >= k; --i) {
+            const Wide t = m_wide[i] % m_modulus;
+            if (t == 0) {
+                continue;
+            }
+            Wide* cell = m_wide.data() + (i - k);
+            for (std::size_t q = 0; q < k; ++q) {
+                cell[q] += t * m_low[q];
+            }
+            if (++rows == m_lazy_rows) {
+                flush(i);
+                rows = 0;
+            }
+        }
+        out.resize(k);
+        for (std::size_t q = 0; q < k; ++q) {
+            out[q] = T(m_wide[q] % m_modulus);
+        }
+    }
+
+    void multiply_native(std::vector<T>& out, const std::vector<T>& a,
+                         const std::vector<T>& b) const {
+        const std::size_t k = m_low.size();
+        m_native.assign(2 * k - 1, T(0));
+        T* acc = m_native.data();
+        if (&a != &b) {
+            for (std::size_t i = 0; i < k; ++i) {
+                if (a[i] == T(0)) {
+                    continue;
+                }
+                const T ai = a[i];
+                for (std::size_t j = 0; j < k; ++j) {
+                    acc[i + j] += ai * b[j];
+                }
+            }
+        } else {
+            for (std::size_t i = 0; i + 1 < k; ++i) {
+                if (a[i] == T(0)) {
+                    continue;
+                }
+                const T ai = a[i];
+                for (std::size_t j = i + 1; j < k; ++j) {
+                    acc[i + j] += ai * a[j];
+                }
+            }
+            for (std::size_t i = 0; i < k; ++i) {
+                acc[2 * i] = acc[2 * i] + acc[2 * i] + a[i] * a[i];
+                if (i + 1 < k) {
+                    acc[2 * i + 1] = acc[2 * i + 1] + acc[2 * i + 1];
+                }
+            }
+        }
+        for (std::size_t i = 2 * k - 2; i >= k; --i) {
+            const T t = acc[i];
+            if (t == T(0)) {
+                continue;
+            }
+            T* cell = acc + (i - k);
+            for (std::size_t q = 0; q < k; ++q) {
+                cell[q] += t * m_low[q];
+            }
+        }
+        out.assign(acc, acc + k);
+    }
+
+public:
+    /*! \brief Creates the operation for the recurrence a(n) = c[0] * a(n - 1) + ... +
+     *         c[k - 1] * a(n - k), where c = \a coefficients.
+     */
+    kitamasa_multiplies(const std::vector<T>& coefficients, T modulus = T(0))
+        : m_low(coefficients.rbegin(), coefficients.rend()), m_modulus(modulus) {
+        assert(!coefficients.empty());
+        if constexpr (has_modular) {
+            if (modulus == T(0)) {
+                return;
+            }
+            for (T& c : m_low) {
+                c %= modulus;
+            }
+            if (modulus > 2) {
+                // an accumulator holds a residue plus this many products of two residues
+                const Wide square = Wide(modulus - 1) * (modulus - 1);
+                const Wide capacity = Wide(-1) / square;
+                if (capacity - 1 < Wide(m_lazy_rows)) {
+                    m_lazy_rows = capacity > 1 ? std::size_t(capacity - 1) : 1;
+                }
+            }
+        } else {
+            assert(modulus == T(0) && "modular arithmetic requires std::uint32_t/std::uint64_t");
+        }
+    }
+
+    std::size_t order() const { return m_low.size(); }
+    T modulus() const { return m_modulus; }
+
+    T reduce(T value) const {
+        if constexpr (has_modular) {
+            if (m_modulus != T(0)) {
+                return value % m_modulus;
+            }
+        }
+        return value;
+    }
+
+    // the polynomial x, reduced
+    std::vector<T> variable() const {
+        std::vector<T> x(order(), T(0));
+        if (order() > 1) {
+            x[1] = identity_element(*this)[0];
+        } else {
+            x[0] = m_low[0];
+        }
+        return x;
+    }
+
+    void operator()(std::vector<T>& out, const std::vector<T>& a, const std::vector<T>& b) const {
+        assert(a.size() == order() && b.size() == order());
+        if constexpr (has_modular) {
+            if (m_modulus != T(0)) {
+                multiply_modular(out, a, b);
+                return;
+            }
+        }
+        multiply_native(out, a, b);
+    }
+
+    std::vector<T> operator()(const std::vector<T>& a, const std::vector<T>& b) const {
+        std::vector<T> out;
+        (*this)(out, a, b);
+        return out;
+    }
+
+    // sum p[q] * values[q] in the same arithmetic
+    T combine(const std::vector<T>& p, const std::vector<T>& values) const {
+        if constexpr (has_modular) {
+            if (m_modulus != T(0)) {
+                Wide sum = 0;
+                std::size_t pending = 0;
+                for (std::size_t q = 0; q < order(); ++q) {
+                    sum += Wide(p[q]) * values[q];
+                    if (++pending == m_lazy_rows) {
+                        sum %= m_modulus;
+                        pending = 0;
+                    }
+                }
+                return T(sum % m_modulus);
+            }
+        }
+        T sum = T(0);
+        for (std::size_t q = 0; q < order(); ++q) {
+            sum += p[q] * values[q];
+        }
+        return sum;
+    }
+
+    friend std::vector<T> identity_element(const kitamasa_multiplies& op) {
+        std::vector<T> one(op.order(), T(0));
+        one[0] = op.reduce(T(1));
+        return one;
+    }
+};
+}  // namespace detail
+
+/*! \brief The order-k linear recurrence a(n) = c[0] * a(n - 1) + ... + c[k - 1] * a(n - k)
+ *         with initial terms a(0), ..., a(k - 1).
+ *
+ *  With a non-zero modulus (std::uint32_t and std::uint64_t only) terms are computed modulo
+ *  it; otherwise the arithmetic of \a T is used as is. A single term costs O(k^2 log n); the
+ *  batch overload precomputes a fixed-base table of x^(2^i) once and serves every query without
+ *  squarings.
+ */
+template<typename T> class linear_recurrence {
+    detail::kitamasa_multiplies<T> m_op;
+    std::vector<T> m_initial;
+    std::vector<T> m_x;
+
+public:
+    linear_recurrence(const std::vector<T>& coefficients, std::vector<T> initial,
+                      T modulus = T(0))
+        : m_op(coefficients, modulus), m_initial(std::move(initial)), m_x(m_op.variable()) {
+        assert(m_initial.size() == coefficients.size());
+        for (T& value : m_initial) {
+            value = m_op.reduce(value);
+        }
+    }
+
+    std::size_t order() const { return m_initial.size(); }
+    T modulus() const { return m_op.modulus(); }
+
+    /*! \brief Returns a(n).
+     */
+    template<typename Integer> T operator()(Integer n) const {
+        assert(n >= 0);
+        if (n < Integer(order())) {
+            return m_initial[std::size_t(n)];
+        }
+        return m_op.combine(power_monoid(m_x, n, m_op), m_initial);
+    }
+
+    /*! \brief Computes d_first[i] = a(first[i]) for every index of [first, last). Returns the end
+     *         of the output range.
+     */
+    template<typename ForwardIt, typename OutputIt>
+    OutputIt operator()(ForwardIt first, ForwardIt last, OutputIt d_first) const {
+        using Integer = typename std::iterator_traits<ForwardIt>::value_type;
+        static_assert(std::is_integral<Integer>::value, "indices must be built-in integers");
+        if (first == last) {
+            return d_first;
+        }
+        using Unsigned = std::make_unsigned_t<Integer>;
+        Unsigned all = 0;
+        std::size_t count = 0;
+        for (ForwardIt it = first; it != last; ++it, ++count) {
+            assert(*it >= 0);
+            all |= Unsigned(*it);
+        }
+        std::size_t bits = 1;
+        while (bits < std::size_t(std::numeric_limits<Unsigned>::digits) && (all >> bits) != 0) {
+            ++bits;
+        }
+        // table of positions * (2^w - 1) polynomials against count * positions * (1 - 2^-w)
+        // products per query
+        std::size_t window = 1;
+        double best = std::numeric_limits<double>::max();
+        for (std::size_t w = 1; w <= 8; ++w) {
+            const double positions = double((bits + w - 1) / w);
+            const double cost = positions * double((std::size_t(1) << w) - 1) +
+                                double(count) * positions * (1.0 - 1.0 / double(1u << w));
+            if (cost < best) {
+                best = cost;
+                window = w;
+            }
+        }
+        const fixed_base_power<std::vector<T>, detail::kitamasa_multiplies<T>> powers(m_x, m_op,
+                                                                                      bits, window);
+        for (; first != last; ++first, ++d_first) {
+            const Integer n = *first;
+            *d_first = n < Integer(order()) ? m_initial[std::size_t(n)]
+                                            : m_op.combine(powers(n), m_initial);
+        }
+        return d_first;
+    }
+};
+
+}  // namespace clsc
@@ -0,0 +1,203 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include "simd_bits.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+/**
+ * \file matrix.hpp
+ * \brief File defines small fixed-size square matrices and vectors, whose multiplication is a
+ * monoid operation suitable for power_monoid (linear recurrences, walk counting and such).
+ */
+namespace clsc {
+
+namespace detail {
+// 64-bit integer lanes are multiplied natively only with AVX-512DQ
+template<typename T>
+constexpr bool is_matrix_simd_v =
+    is_simd_arithmetic_v<T> && (sizeof(T) < 8 || std::is_floating_point<T>::value ||
+#if defined(__AVX512DQ__)
+                                true
+#else
+                                false
+#endif
+                               );
+
+template<typename T> constexpr std::size_t matrix_row_stride(std::size_t n) {
+#if defined(CLSC_VECTOR_EXTENSIONS)
+    if (is_matrix_simd_v<T>) {
+        // rows are padded to whole vectors, padding is always zero
+        const std::size_t lanes = simd_bytes / sizeof(T);
+        return (n + lanes - 1) / lanes * lanes;
+    }
+#endif
+    return n;
+}
+}  // namespace detail
+
+template<typename T, std::size_t N> struct Matrix;
+
+namespace detail {
+template<typename T, std::size_t N>
+void matrix_multiply(Matrix<T, N>& c, const Matrix<T, N>& a, const Matrix<T, N>& b);
+}  // namespace detail
+
+/*! \brief Square \a N x \a N matrix stored row by row in cache line aligned memory.
+ *
+ *  Rows are padded to a whole number of SIMD vectors, so the multiplication kernel processes
+ *  every row with full-width vector operations. 64-bit integer elements (e.g. std::uint64_t)
+ *  use the scalar triple loop unless AVX-512DQ is available: without a native 64-bit lane
+ *  multiply, an emulation from 32 x 32-bit partial products measured slower than the loop the
+ *  compiler vectorizes on its own.
+ */
+template<typename T, std::size_t N> struct alignas(64) Matrix {
+    static constexpr std::size_t size = N;
+    static constexpr std::size_t stride = detail::matrix_row_stride<T>(N);
+
+    T data[N * stride] = {};
+
+    constexpr Matrix() = default;
+    // row by row list of elements
+    template<typename... Ts, typename = std::enable_if_t<sizeof...(Ts) == N * N>>
+    constexpr Matrix(Ts... values) {
+        const T elements[] = {T(values)...};
+        for (std::size_t i = 0; i < N * N; ++i) {
+            data[i / N * stride + i % N] = elements[i];
+        }
+    }
+
+    static constexpr Matrix identity() {
+        Matrix m;
+        for (std::size_t i = 0; i < N; ++i) {
+            m(i, i) = T(1);
+        }
+        return m;
+    }
+
+    constexpr T& operator()(std::size_t i, std::size_t j) { return data[i * stride + j]; }
+    constexpr const T& operator()(std::size_t i, std::size_t j) const {
+        return data[i * stride + j];
+    }
+
+    friend constexpr bool operator==(const Matrix& a, const Matrix& b) {
+        for (std::size_t i = 0; i < N * stride; ++i) {
+            if (!(a.data[i] == b.data[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+    friend constexpr bool operator!=(const Matrix& a, const Matrix& b) { return !(a == b); }
+
+    friend Matrix operator*(const Matrix& a, const Matrix& b) {
+        Matrix c;
+        detail::matrix_multiply(c, a, b);
+        return c;
+    }
+};
+
+template<typename T, std::size_t N> struct alignas(64) Vector {
+    static constexpr std::size_t size = N;
+
+    T data[N] = {};
+
+    constexpr T& operator[](std::size_t i) { return data[i]; }
+    constexpr const T& operator[](std::size_t i) const { return data[i]; }
+
+    friend constexpr bool operator==(const Vector& a, const Vector& b) {
+        for (std::size_t i = 0; i < N; ++i) {
+            if (!(a.data[i] == b.data[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+    friend constexpr bool operator!=(const Vector& a, const Vector& b) { return !(a == b); }
+
+    // square matrix multiplied by column vector
+    friend constexpr Vector operator*(const Matrix<T, N>& m, const Vector& v) {
+        Vector r;
+        for (std::size_t i = 0; i < N; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                r.data[i] += m(i, j) * v.data[j];
+            }
+        }
+        return r;
+    }
+};
+
+template<typename T, std::size_t N>
+constexpr Matrix<T, N> identity_element(std::multiplies<Matrix<T, N>>) {
+    return Matrix<T, N>::identity();
+}
+
+namespace detail {
+// c = a * b, c never aliases a or b
+template<typename T, std::size_t N>
+void matrix_multiply(Matrix<T, N>& c, const Matrix<T, N>& a, const Matrix<T, N>& b) {
+    constexpr std::size_t stride = Matrix<T, N>::stride;
+#if defined(CLSC_VECTOR_EXTENSIONS)
+    if constexpr (is_matrix_simd_v<T>) {
+        // c[i, :] = sum over k of a[i, k] * b[k, :], a row of c stays in registers
+        constexpr std::size_t vectors = stride / simd_lanes<T>;
+        for (std::size_t i = 0; i < N; ++i) {
+            simd_vector<T> row[vectors] = {};
+            for (std::size_t k = 0; k < N; ++k) {
+                const simd_vector<T> aik = simd_broadcast(a(i, k));
+                for (std::size_t v = 0; v < vectors; ++v) {
+                    row[v] += aik * simd_load(&b(k, 0) + v * simd_lanes<T>);
+                }
+            }
+            for (std::size_t v = 0; v < vectors; ++v) {
+                simd_store(&c(i, 0) + v * simd_lanes<T>, row[v]);
+            }
+        }
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < N; ++i) {
+        T row[stride] = {};
+        for (std::size_t k = 0; k < N; ++k) {
+            for (std::size_t j = 0; j < N; ++j) {
+                row[j] += a(i, k) * b(k, j);
+            }
+        }
+        for (std::size_t j = 0; j < N; ++j) {
+            c(i, j) = row[j];
+        }
+    }
+}
+}  // namespace detail
+
+}  // namespace clsc
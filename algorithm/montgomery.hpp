@@ -0,0 +1,179 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include "algorithm.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+/**
+ * \file montgomery.hpp
+ * \brief File defines Montgomery modular multiplication as a monoid operation. Operands are kept
+ * in Montgomery form x * R mod m (R = 2^bits), which turns every modular product into two
+ * multiplications and a subtraction, with no division. Values are converted at the edges only.
+ */
+namespace clsc {
+
+namespace detail {
+template<typename UInt> struct montgomery_wide;
+template<> struct montgomery_wide<std::uint32_t> {
+    using type = std::uint64_t;
+    using signed_type = std::int64_t;
+};
+template<> struct montgomery_wide<std::uint64_t> {
+    using type = unsigned __int128;
+    using signed_type = __int128;
+};
+}  // namespace detail
+
+/*! \brief Modular multiplication of values in Montgomery form, for any odd modulus.
+ *
+ *  \a UInt is either std::uint32_t or std::uint64_t.
+ */
+template<typename UInt> class montgomery_multiplies {
+    using Wide = typename detail::montgomery_wide<UInt>::type;
+    static constexpr int bits = std::numeric_limits<UInt>::digits;
+
+    UInt m_modulus = 1;
+    UInt m_inverse = 1;  // m_modulus^-1 mod R
+    UInt m_r_mod = 0;    // R mod m_modulus, Montgomery form of 1
+    UInt m_r2_mod = 0;   // R^2 mod m_modulus
+
+public:
+    explicit constexpr montgomery_multiplies(UInt modulus) : m_modulus(modulus) {
+        assert(modulus % 2 == 1 && "Montgomery multiplication requires an odd modulus");
+        // Newton iteration, every step doubles the number of correct low bits (3 initially)
+        m_inverse = modulus;
+        for (int correct = 3; correct < bits; correct *= 2) {
+            m_inverse *= UInt(2) - modulus * m_inverse;
+        }
+        m_r_mod = UInt(-modulus) % modulus;
+        m_r2_mod = UInt(Wide(m_r_mod) * m_r_mod % modulus);
+    }
+
+    constexpr UInt modulus() const { return m_modulus; }
+
+    // computes t * R^-1 mod m for t < m * R
+    constexpr UInt reduce(Wide t) const {
+        const UInt low = UInt(t);
+        const UInt high = UInt(t >> bits);
+        // u * m has the same low half as t, so (t - u * m) / R is a difference of high halves
+        const UInt u = low * m_inverse;
+        const UInt um_high = UInt((Wide(u) * m_modulus) >> bits);
+        return high >= um_high ? high - um_high : high - um_high + m_modulus;
+    }
+
+    constexpr UInt to_montgomery(UInt x) const { return reduce(Wide(x % m_modulus) * m_r2_mod); }
+    constexpr UInt from_montgomery(UInt x) const { return reduce(Wide(x)); }
+
+    constexpr UInt operator()(UInt a, UInt b) const { return reduce(Wide(a) * b); }
+
+    friend constexpr UInt identity_element(const montgomery_multiplies& op) { return op.m_r_mod; }
+
+    // maps an element to its inverse, elements not coprime with the modulus are mapped to 0
+    friend constexpr auto inverse_element(const montgomery_multiplies& op) {
+        return [op](UInt x) {
+            // extended Euclid on the plain value: inverse(x * R) = inverse(x) * R^-1 * R^2
+            using Signed = typename detail::montgomery_wide<UInt>::signed_type;
+            Signed r0 = op.m_modulus, r1 = op.from_montgomery(x);
+            Signed s0 = 0, s1 = 1;
+            while (r1 != 0) {
+                const Signed q = r0 / r1;
+                const Signed r2 = r0 - q * r1;
+                r0 = r1;
+                r1 = r2;
+                const Signed s2 = s0 - q * s1;
+                s0 = s1;
+                s1 = s2;
+            }
+            if (r0 != 1) {
+                return UInt(0);
+            }
+            const UInt plain = UInt(s0 < 0 ? s0 + Signed(op.m_modulus) : s0);
+            return op.to_montgomery(plain);
+        };
+    }
+};
+
+template<typename UInt> struct is_commutative<montgomery_multiplies<UInt>> : std::true_type {};
+
+/*! \brief Computes a^n mod op.modulus() for a plain (not Montgomery form) value \a a.
+ */
+template<typename UInt, typename Integer>
+constexpr UInt montgomery_power(UInt a, Integer n, const montgomery_multiplies<UInt>& op) {
+    return op.from_montgomery(power_monoid(op.to_montgomery(a), n, op));
+}
+
+/*! \brief Computes d_first[i] = a[i]^n[i] mod op.modulus() for plain values a = [first, last)
+ *         and exponents n = [n_first, n_first + (last - first)).
+ *
+ *  Exponentiations run in groups of \a Lanes side by side: every step issues independent
+ *  products for all lanes, which hides the latency of the multiplier. Returns the end of the
+ *  output range.
+ */
+template<std::size_t Lanes = 8, typename InputIt, typename ExponentIt, typename OutputIt,
+         typename UInt>
+OutputIt montgomery_power_batch(InputIt first, InputIt last, ExponentIt n_first, OutputIt d_first,
+                                const montgomery_multiplies<UInt>& op) {
+    using Exponent = std::make_unsigned_t<typename std::iterator_traits<ExponentIt>::value_type>;
+    const UInt one = identity_element(op);
+    while (first != last) {
+        UInt r[Lanes];
+        UInt a[Lanes];
+        Exponent n[Lanes];
+        std::size_t lanes = 0;
+        Exponent any = 0;
+        for (; lanes < Lanes && first != last; ++lanes, ++first, ++n_first) {
+            r[lanes] = one;
+            a[lanes] = op.to_montgomery(*first);
+            n[lanes] = Exponent(*n_first);
+            any |= n[lanes];
+        }
+        // right-to-left binary method in lockstep, selects instead of branches
+        for (; any != 0; any >>= 1) {
+            for (std::size_t i = 0; i < lanes; ++i) {
+                const UInt product = op(r[i], a[i]);
+                r[i] = (n[i] & 1u) ? product : r[i];
+                a[i] = op(a[i], a[i]);
+                n[i] >>= 1;
+            }
+        }
+        for (std::size_t i = 0; i < lanes; ++i, ++d_first) {
+            *d_first = op.from_montgomery(r[i]);
+        }
+    }
+    return d_first;
+}
+
+}  // namespace clsc
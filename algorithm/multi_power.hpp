@@ -0,0 +1,194 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include "algorithm.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file multi_power.hpp
+ * \brief File defines simultaneous multi-exponentiation: a^n * b^m * ... * c^k computed with one
+ * shared chain of squarings instead of one chain per base.
+ */
+namespace clsc {
+
+namespace detail {
+// number of bases up to which Shamir's trick precomputes all 2^k - 1 subset products
+constexpr std::size_t max_shamir_bases = 4;
+
+// accumulates the result, the first factor is assigned instead of multiplied into the identity
+template<typename Regular, typename MonoidOperation> class multi_power_accumulator {
+    Regular m_result;
+    bool m_started = false;
+    decltype(make_operation_buffer<MonoidOperation>(std::declval<const Regular&>())) m_buffer;
+
+public:
+    multi_power_accumulator(Regular identity)
+        : m_result(std::move(identity)),
+          m_buffer(make_operation_buffer<MonoidOperation>(m_result)) {}
+
+    void square(MonoidOperation& op) {
+        if (m_started) {
+            accumulate_operation(m_result, m_result, m_buffer, op);
+        }
+    }
+    void multiply(const Regular& x, MonoidOperation& op) {
+        if (m_started) {
+            accumulate_operation(m_result, x, m_buffer, op);
+        } else {
+            m_result = x;
+            m_started = true;
+        }
+    }
+    Regular& result() { return m_result; }
+};
+
+// Shamir's trick: one multiplication by a precomputed subset product per exponent bit
+template<typename Regular, typename Integer, typename MonoidOperation>
+Regular multi_power_shamir(const std::vector<Regular>& bases,
+                           const std::vector<exponent_bits<Integer>>& bits, std::size_t max_bits,
+                           MonoidOperation& op, Regular identity) {
+    const std::size_t k = bases.size();
+    std::vector<Regular> subsets(std::size_t(1) << k, identity);
+    for (std::size_t mask = 1; mask < subsets.size(); ++mask) {
+        const std::size_t lowest = mask & (~mask + 1);
+        std::size_t index = 0;
+        while ((std::size_t(1) << index) != lowest) {
+            ++index;
+        }
+        subsets[mask] = mask == lowest ? bases[index] : op(subsets[mask ^ lowest], bases[index]);
+    }
+
+    multi_power_accumulator<Regular, MonoidOperation> r(std::move(identity));
+    for (std::size_t bit = max_bits; bit-- > 0;) {
+        r.square(op);
+        std::size_t mask = 0;
+        for (std::size_t i = 0; i < k; ++i) {
+            if (bit < bits[i].size() && bits[i][bit]) {
+                mask |= std::size_t(1) << i;
+            }
+        }
+        if (mask != 0) {
+            r.multiply(subsets[mask], op);
+        }
+    }
+    return std::move(r.result());
+}
+
+// interleaved sliding windows: every base has its own table of odd powers, windows of all bases
+// are multiplied into one shared chain of squarings
+template<typename Regular, typename Integer, typename MonoidOperation>
+Regular multi_power_interleaved(std::vector<Regular> bases,
+                                const std::vector<exponent_bits<Integer>>& bits,
+                                std::size_t max_bits, std::size_t width, MonoidOperation& op,
+                                Regular identity) {
+    struct window {
+        std::size_t base;
+        std::size_t value;
+    };
+    // windows ending at every bit position, found by scanning every exponent from the top
+    std::vector<std::vector<window>> windows(max_bits);
+    std::vector<std::vector<Regular>> odd_powers(bases.size());
+    for (std::size_t b = 0; b < bases.size(); ++b) {
+        if (bits[b].size() == 0) {
+            continue;
+        }
+        odd_powers[b] = odd_powers_table(std::move(bases[b]), width, op);
+        for (std::size_t i = bits[b].size(); i-- > 0;) {
+            if (bits[b][i]) {
+                std::size_t l = 0;
+                const std::size_t value = sliding_window_at(bits[b], i, width, l);
+                windows[l].push_back({b, value});
+                i = l;
+            }
+        }
+    }
+
+    multi_power_accumulator<Regular, MonoidOperation> r(std::move(identity));
+    for (std::size_t bit = max_bits; bit-- > 0;) {
+        r.square(op);
+        for (const window& w : windows[bit]) {
+            r.multiply(odd_powers[w.base][w.value / 2], op);
+        }
+    }
+    return std::move(r.result());
+}
+}  // namespace detail
+
+/*! \brief Computes bases[0]^exponents[0] op bases[1]^exponents[1] op ... with one chain of
+ *         squarings shared by all bases.
+ *
+ *  The bases must commute with each other under \a op (e.g. \a op is commutative), exponents must
+ *  be non-negative. With \a W equal to 0, up to detail::max_shamir_bases bases use Shamir's trick
+ *  (all subset products are precomputed, one multiplication per exponent bit), more bases fall
+ *  back to interleaved binary exponentiation. Non-zero \a W selects interleaved sliding windows
+ *  of width \a W with a table of odd powers per base. Either way the cost is close to a single
+ *  exponentiation instead of one per base.
+ */
+template<std::size_t W = 0, typename Bases, typename Exponents, typename MonoidOperation>
+auto multi_power(const Bases& bases, const Exponents& exponents, MonoidOperation op)
+    -> std::decay_t<decltype(*std::begin(bases))> {
+    using Regular = std::decay_t<decltype(*std::begin(bases))>;
+    using Integer = std::decay_t<decltype(*std::begin(exponents))>;
+    static_assert(W < 16, "window width is too large");
+
+    std::vector<Regular> used_bases;
+    std::vector<detail::exponent_bits<Integer>> bits;
+    std::size_t max_bits = 0;
+    auto n = std::begin(exponents);
+    for (auto a = std::begin(bases); a != std::end(bases); ++a, ++n) {
+        assert(n != std::end(exponents) && *n >= 0);
+        if (*n == Integer(0)) {
+            continue;
+        }
+        used_bases.push_back(*a);
+        bits.emplace_back(*n);
+        max_bits = std::max(max_bits, bits.back().size());
+    }
+
+    using clsc::detail::identity_element;
+    Regular identity = identity_element(op);
+    if (used_bases.empty()) {
+        return identity;
+    }
+    if (W == 0 && used_bases.size() <= detail::max_shamir_bases) {
+        return detail::multi_power_shamir(used_bases, bits, max_bits, op, std::move(identity));
+    }
+    return detail::multi_power_interleaved(std::move(used_bases), bits, max_bits,
+                                           W == 0 ? 1 : W, op, std::move(identity));
+}
+
+}  // namespace clsc
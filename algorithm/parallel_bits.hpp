@@ -0,0 +1,126 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace clsc {
+namespace detail {
+
+// minimal number of elements per worker for a range to be split between threads
+constexpr std::size_t parallel_min_chunk = std::size_t(1) << 14;
+
+inline std::size_t hardware_threads() {
+    const std::size_t count = std::thread::hardware_concurrency();
+    return count == 0 ? 1 : count;
+}
+
+// number of workers to split \a n elements between: at most \a threads (0 means one per core),
+// each getting at least \a min_chunk elements
+inline std::size_t worker_count(std::size_t n, std::size_t threads, std::size_t min_chunk) {
+    const std::size_t max_workers = threads == 0 ? hardware_threads() : threads;
+    return std::max<std::size_t>(1, std::min(max_workers, n / std::max<std::size_t>(1, min_chunk)));
+}
+
+// [begin, end) of the i-th out of \a count nearly equal chunks of [0, n)
+inline std::pair<std::size_t, std::size_t> chunk_bounds(std::size_t n, std::size_t count,
+                                                        std::size_t i) {
+    const std::size_t base = n / count;
+    const std::size_t extra = n % count;
+    const std::size_t begin = i * base + std::min(i, extra);
+    return {begin, begin + base + (i < extra ? 1 : 0)};
+}
+
+// calls f(i) for every i in [0, count), each on its own thread, the calling thread takes i == 0.
+// the first exception thrown by any call is rethrown after all threads finish
+template<typename Function> void parallel_invoke_n(std::size_t count, Function f) {
+    if (count <= 1) {
+        if (count == 1) {
+            f(std::size_t(0));
+        }
+        return;
+    }
+    std::vector<std::exception_ptr> errors(count);
+    const auto task = [&](std::size_t i) {
+        try {
+            f(i);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(count - 1);
+    for (std::size_t i = 1; i < count; ++i) {
+        workers.emplace_back(task, i);
+    }
+    task(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+// reusable rendezvous point of \a count threads, a C++17 stand-in for std::barrier. every thread
+// must reach every phase, so it only suits work that does not throw between phases
+class thread_barrier {
+    std::mutex m_mutex;
+    std::condition_variable m_released;
+    std::size_t m_count;
+    std::size_t m_waiting = 0;
+    std::size_t m_phase = 0;
+
+public:
+    explicit thread_barrier(std::size_t count) : m_count(count) {}
+
+    void arrive_and_wait() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (++m_waiting == m_count) {
+            m_waiting = 0;
+            ++m_phase;
+            m_released.notify_all();
+            return;
+        }
+        const std::size_t phase = m_phase;
+        m_released.wait(lock, [&] { return phase != m_phase; });
+    }
+};
+
+}  // namespace detail
+}  // namespace clsc
@@ -0,0 +1,270 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include "algorithm.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file permutation.hpp
+ * \brief File defines permutations of [0, n) as a group under composition. Powers are computed
+ * by rotating every cycle by the exponent modulo the cycle length, which takes a single O(n)
+ * pass for any exponent instead of O(n log k) compositions.
+ */
+namespace clsc {
+
+class permutation_compose;
+
+/*! \brief Permutation of [0, size()), mapping i to (*this)[i].
+ */
+class permutation {
+    friend class permutation_compose;
+
+public:
+    using index_type = std::uint32_t;
+
+private:
+    std::vector<index_type> m_images;
+
+public:
+    permutation() = default;
+    // identity permutation of [0, n)
+    explicit permutation(std::size_t n) : m_images(n) {
+        assert(n <= std::numeric_limits<index_type>::max());
+        for (std::size_t i = 0; i < n; ++i) {
+            m_images[i] = index_type(i);
+        }
+    }
+    // images of 0, 1, ..., which must be a rearrangement of [0, images.size())
+    explicit permutation(std::vector<index_type> images) : m_images(std::move(images)) {}
+
+    std::size_t size() const { return m_images.size(); }
+    index_type operator[](std::size_t i) const { return m_images[i]; }
+    index_type& operator[](std::size_t i) { return m_images[i]; }
+    const std::vector<index_type>& images() const { return m_images; }
+
+    friend bool operator==(const permutation& a, const permutation& b) {
+        return a.m_images == b.m_images;
+    }
+    friend bool operator!=(const permutation& a, const permutation& b) { return !(a == b); }
+};
+
+/*! \brief Composition of permutations: op(a, b) applies b first, op(a, b)[i] == a[b[i]].
+ *
+ *  \a size is the size of the identity_element, needed only by generic algorithms; the power
+ *  functions below derive it from their argument.
+ */
+class permutation_compose {
+    std::size_t m_size = 0;
+
+public:
+    explicit permutation_compose(std::size_t size = 0) : m_size(size) {}
+
+    // out = a * b, out must not alias a or b
+    void operator()(permutation& out, const permutation& a, const permutation& b) const {
+        assert(a.size() == b.size());
+        assert(&out != &a && &out != &b);
+        const std::size_t n = b.size();
+        auto& images = out.m_images;
+        images.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            images[i] = a[b[i]];
+        }
+    }
+
+    permutation operator()(const permutation& a, const permutation& b) const {
+        permutation out;
+        (*this)(out, a, b);
+        return out;
+    }
+
+    friend permutation identity_element(const permutation_compose& op) {
+        return permutation(op.m_size);
+    }
+
+    // O(n) inversion: inverse[a[i]] == i
+    friend auto inverse_element(const permutation_compose&) {
+        return [](const permutation& a) {
+            std::vector<permutation::index_type> images(a.size());
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                images[a[i]] = permutation::index_type(i);
+            }
+            return permutation(std::move(images));
+        };
+    }
+};
+
+namespace detail {
+// number of cycle walks interleaved by permutation_power
+constexpr std::size_t permutation_walkers = 16;
+
+// consecutive elements of a cycle, stored in buffers[buffer][begin:end), followed by the fragment
+// with index next
+struct permutation_fragment {
+    static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
+    std::size_t buffer = 0;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    std::size_t next = none;
+};
+
+// a^n for any integer n, every cycle of a is rotated by n modulo its length
+template<typename Integer> permutation permutation_power(const permutation& a, Integer n) {
+    static_assert(std::is_integral<Integer>::value, "exponent must be a built-in integer");
+    using Wide = std::conditional_t<std::is_signed<Integer>::value, std::int64_t, std::uint64_t>;
+    using index_type = permutation::index_type;
+    constexpr std::size_t none = permutation_fragment::none;
+    constexpr std::size_t walkers = permutation_walkers;
+    const std::size_t size = a.size();
+
+    // a walk along a cycle is a chain of dependent loads, bound by memory latency. several walks
+    // run in lockstep from different starting points instead, each producing a fragment of some
+    // cycle that ends right before the start of another fragment (or its own). until the images
+    // are computed, images[i] holds the fragment that starts at i
+    std::vector<index_type> images(size);
+    std::vector<permutation_fragment> fragments;
+    std::vector<index_type> buffers[walkers];
+    std::vector<std::uint64_t> visited((size + 63) / 64);
+    const auto is_visited = [&](std::size_t i) { return (visited[i / 64] >> (i % 64) & 1u) != 0; };
+    const auto visit = [&](std::size_t i) { visited[i / 64] |= std::uint64_t(1) << (i % 64); };
+
+    std::size_t walk_buffer[walkers];
+    std::size_t walk_position[walkers];
+    std::size_t walks = 0;
+    std::size_t scan = 0;
+    // starts a walk in slot w at the next unvisited element, if any
+    const auto start_walk = [&](std::size_t w) {
+        while (scan < size && is_visited(scan)) {
+            ++scan;
+        }
+        if (scan == size) {
+            return false;
+        }
+        auto& buffer = buffers[walk_buffer[w]];
+        visit(scan);
+        images[scan] = index_type(fragments.size());
+        fragments.push_back({walk_buffer[w], buffer.size(), buffer.size(), none});
+        buffer.push_back(index_type(scan));
+        walk_position[w] = a[scan];
+        return true;
+    };
+    for (std::size_t w = 0; w < walkers; ++w) {
+        walk_buffer[w] = w;
+    }
+    while (walks < walkers && start_walk(walks)) {
+        ++walks;
+    }
+    std::size_t walk_fragment[walkers];
+    for (std::size_t w = 0; w < walks; ++w) {
+        walk_fragment[w] = w;
+    }
+    while (walks > 0) {
+        for (std::size_t w = 0; w < walks;) {
+            const std::size_t i = walk_position[w];
+            if (!is_visited(i)) {
+                visit(i);
+                buffers[walk_buffer[w]].push_back(index_type(i));
+                walk_position[w] = a[i];
+                ++w;
+                continue;
+            }
+            // the predecessor of i was visited by this walk, so i starts a fragment
+            auto& finished = fragments[walk_fragment[w]];
+            finished.end = buffers[finished.buffer].size();
+            finished.next = images[i];
+            walk_fragment[w] = fragments.size();
+            if (!start_walk(w)) {
+                --walks;
+                std::swap(walk_buffer[w], walk_buffer[walks]);
+                walk_position[w] = walk_position[walks];
+                walk_fragment[w] = walk_fragment[walks];
+            }
+        }
+    }
+
+    std::vector<index_type> cycle;
+    for (std::size_t first = 0; first < fragments.size(); ++first) {
+        if (fragments[first].next == none) {
+            continue;  // already placed
+        }
+        cycle.clear();
+        for (std::size_t f = first; fragments[f].next != none;) {
+            const auto& elements = buffers[fragments[f].buffer];
+            cycle.insert(cycle.end(), elements.begin() + fragments[f].begin,
+                         elements.begin() + fragments[f].end);
+            f = std::exchange(fragments[f].next, none);
+        }
+        // a^n maps cycle[j] to cycle[j + n mod length]
+        const std::size_t length = cycle.size();
+        Wide shift = Wide(n) % Wide(length);
+        if constexpr (std::is_signed<Wide>::value) {
+            if (shift < 0) {
+                shift += Wide(length);
+            }
+        }
+        std::size_t target = std::size_t(shift);
+        for (std::size_t j = 0; j < length; ++j) {
+            images[cycle[j]] = cycle[target];
+            if (++target == length) {
+                target = 0;
+            }
+        }
+    }
+    return permutation(std::move(images));
+}
+}  // namespace detail
+
+// power_semigroup, power_monoid and power_group overloads for permutations take the cycle path
+
+template<typename Integer>
+permutation power_semigroup(const permutation& a, Integer n, permutation_compose) {
+    assert(n > 0);
+    return detail::permutation_power(a, n);
+}
+
+template<typename Integer>
+permutation power_monoid(const permutation& a, Integer n, permutation_compose) {
+    assert(n >= 0);
+    return detail::permutation_power(a, n);
+}
+
+template<typename Integer>
+permutation power_group(const permutation& a, Integer n, permutation_compose) {
+    return detail::permutation_power(a, n);
+}
+
+}  // namespace clsc
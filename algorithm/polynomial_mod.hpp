@@ -0,0 +1,411 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include "algorithm.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file polynomial_mod.hpp
+ * \brief File defines polynomials with coefficients modulo an NTT-friendly prime. Products
+ * switch from the schoolbook method to Karatsuba to the number-theoretic transform as operands
+ * grow, so power_monoid stays usable for polynomials with millions of coefficients.
+ */
+namespace clsc {
+
+namespace detail {
+template<std::uint32_t P> struct multiplies_mod_prime {
+    constexpr std::uint32_t operator()(std::uint32_t a, std::uint32_t b) const {
+        return std::uint32_t(std::uint64_t(a) * b % P);
+    }
+    friend constexpr std::uint32_t identity_element(multiplies_mod_prime) { return 1; }
+};
+
+template<std::uint32_t P> constexpr std::uint32_t power_mod_prime(std::uint32_t a,
+                                                                  std::uint64_t n) {
+    return power_monoid(a, n, multiplies_mod_prime<P>{});
+}
+
+// largest s such that 2^s divides P - 1, the longest transform is 2^s
+template<std::uint32_t P> constexpr std::size_t ntt_two_adicity() {
+    std::size_t s = 0;
+    while (((P - 1) >> s & 1u) == 0) {
+        ++s;
+    }
+    return s;
+}
+
+// smallest generator of the multiplicative group modulo P
+template<std::uint32_t P> constexpr std::uint32_t ntt_primitive_root() {
+    std::uint32_t factors[32] = {};
+    std::size_t count = 0;
+    std::uint32_t rest = P - 1;
+    for (std::uint32_t q = 2; std::uint64_t(q) * q <= rest; ++q) {
+        if (rest % q == 0) {
+            factors[count++] = q;
+            while (rest % q == 0) {
+                rest /= q;
+            }
+        }
+    }
+    if (rest > 1) {
+        factors[count++] = rest;
+    }
+    for (std::uint32_t g = 2;; ++g) {
+        bool generator = true;
+        for (std::size_t i = 0; i < count && generator; ++i) {
+            generator = power_mod_prime<P>(g, (P - 1) / factors[i]) != 1;
+        }
+        if (generator) {
+            return g;
+        }
+    }
+}
+
+/*! \brief Size thresholds (length of the shorter operand) of the multiplication methods.
+ */
+constexpr std::size_t polynomial_karatsuba_threshold = 32;
+constexpr std::size_t polynomial_ntt_threshold = 192;
+// log2 of the shortest transform the NTT method needs, for two operands at its threshold
+constexpr std::size_t polynomial_ntt_min_log_size = 9;
+static_assert((std::size_t(1) << polynomial_ntt_min_log_size) >= 2 * polynomial_ntt_threshold - 1,
+              "transform too short for the NTT threshold");
+
+// products of two residues an std::uint64_t sum absorbs before it has to be reduced
+template<std::uint32_t P> constexpr std::size_t polynomial_lazy_terms() {
+    const std::uint64_t square = std::uint64_t(P - 1) * (P - 1);
+    return std::size_t(std::numeric_limits<std::uint64_t>::max() / square);
+}
+
+// out[0:limit) = (a * b)[0:limit)
+template<std::uint32_t P>
+void polynomial_schoolbook(const std::uint32_t* a, std::size_t na, const std::uint32_t* b,
+                           std::size_t nb, std::uint32_t* out, std::size_t limit) {
+    constexpr std::size_t lazy = polynomial_lazy_terms<P>();
+    for (std::size_t s = 0; s < limit; ++s) {
+        const std::size_t first = s >= nb ? s - nb + 1 : 0;
+        const std::size_t last = std::min(s + 1, na);
+        std::uint64_t sum = 0;
+        std::size_t pending = 0;
+        for (std::size_t i = first; i < last; ++i) {
+            sum += std::uint64_t(a[i]) * b[s - i];
+            if (++pending == lazy) {
+                sum %= P;
+                pending = 0;
+            }
+        }
+        out[s] = std::uint32_t(sum % P);
+    }
+}
+
+template<std::uint32_t P> std::uint32_t add_mod_prime(std::uint32_t a, std::uint32_t b) {
+    const std::uint32_t sum = a + b;
+    return sum >= P ? sum - P : sum;
+}
+template<std::uint32_t P> std::uint32_t subtract_mod_prime(std::uint32_t a, std::uint32_t b) {
+    return a >= b ? a - b : a + P - b;
+}
+
+// out[0:na + nb - 1) = a * b
+template<std::uint32_t P>
+void polynomial_karatsuba(const std::uint32_t* a, std::size_t na, const std::uint32_t* b,
+                          std::size_t nb, std::uint32_t* out) {
+    if (na < nb) {
+        std::swap(a, b);
+        std::swap(na, nb);
+    }
+    if (nb < polynomial_karatsuba_threshold) {
+        polynomial_schoolbook<P>(a, na, b, nb, out, na + nb - 1);
+        return;
+    }
+    if (na >= 2 * nb) {
+        // unbalanced: slices of a as long as b
+        std::fill(out, out + na + nb - 1, 0u);
+        std::vector<std::uint32_t> slice(2 * nb - 1);
+        for (std::size_t i = 0; i < na; i += nb) {
+            const std::size_t length = std::min(nb, na - i);
+            polynomial_karatsuba<P>(a + i, length, b, nb, slice.data());
+            for (std::size_t j = 0; j < length + nb - 1; ++j) {
+                out[i + j] = add_mod_prime<P>(out[i + j], slice[j]);
+            }
+        }
+        return;
+    }
+    // a = a0 + x^h a1, b = b0 + x^h b1, nb > h - 1
+    const std::size_t h = (na + 1) / 2;
+    const std::size_t na1 = na - h;
+    const std::size_t nb0 = std::min(h, nb);
+    const std::size_t nb1 = nb - nb0;
+    std::fill(out, out + na + nb - 1, 0u);
+    std::vector<std::uint32_t> z0(h + nb0 - 1);
+    polynomial_karatsuba<P>(a, h, b, nb0, z0.data());
+    if (nb1 == 0) {
+        std::vector<std::uint32_t> z2(na1 + nb0 - 1);
+        polynomial_karatsuba<P>(a + h, na1, b, nb0, z2.data());
+        std::copy(z0.begin(), z0.end(), out);
+        for (std::size_t i = 0; i < z2.size(); ++i) {
+            out[h + i] = add_mod_prime<P>(out[h + i], z2[i]);
+        }
+        return;
+    }
+    std::vector<std::uint32_t> z2(na1 + nb1 - 1);
+    polynomial_karatsuba<P>(a + h, na1, b + h, nb1, z2.data());
+    std::vector<std::uint32_t> sum_a(a, a + h);
+    std::vector<std::uint32_t> sum_b(b, b + nb0);
+    for (std::size_t i = 0; i < na1; ++i) {
+        sum_a[i] = add_mod_prime<P>(sum_a[i], a[h + i]);
+    }
+    for (std::size_t i = 0; i < nb1; ++i) {
+        sum_b[i] = add_mod_prime<P>(sum_b[i], b[h + i]);
+    }
+    std::vector<std::uint32_t> z1(h + nb0 - 1);
+    polynomial_karatsuba<P>(sum_a.data(), h, sum_b.data(), nb0, z1.data());
+    for (std::size_t i = 0; i < z0.size(); ++i) {
+        z1[i] = subtract_mod_prime<P>(z1[i], z0[i]);
+        out[i] = z0[i];
+    }
+    for (std::size_t i = 0; i < z2.size(); ++i) {
+        z1[i] = subtract_mod_prime<P>(z1[i], z2[i]);
+        out[2 * h + i] = z2[i];
+    }
+    for (std::size_t i = 0; i < z1.size(); ++i) {
+        out[h + i] = add_mod_prime<P>(out[h + i], z1[i]);
+    }
+}
+
+// in-place transform of a power of two length, \a inverse includes the division by the length
+template<std::uint32_t P> void ntt(std::vector<std::uint32_t>& a, bool inverse) {
+    constexpr std::uint32_t g = ntt_primitive_root<P>();
+    const std::size_t n = a.size();
+    assert(n > 0 && (n & (n - 1)) == 0 && n <= (std::size_t(1) << ntt_two_adicity<P>()));
+    for (std::size_t i = 1, j = 0; i < n; ++i) {
+        std::size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(a[i], a[j]);
+        }
+    }
+    std::vector<std::uint32_t> roots(n / 2);
+    for (std::size_t length = 2; length <= n; length <<= 1) {
+        const std::size_t half = length / 2;
+        std::uint32_t w = power_mod_prime<P>(g, (P - 1) / length);
+        if (inverse) {
+            w = power_mod_prime<P>(w, P - 2);
+        }
+        roots[0] = 1;
+        for (std::size_t j = 1; j < half; ++j) {
+            roots[j] = std::uint32_t(std::uint64_t(roots[j - 1]) * w % P);
+        }
+        for (std::size_t i = 0; i < n; i += length) {
+            std::uint32_t* low = a.data() + i;
+            std::uint32_t* high = low + half;
+            for (std::size_t j = 0; j < half; ++j) {
+                const std::uint32_t u = low[j];
+                const std::uint32_t v = std::uint32_t(std::uint64_t(high[j]) * roots[j] % P);
+                low[j] = add_mod_prime<P>(u, v);
+                high[j] = subtract_mod_prime<P>(u, v);
+            }
+        }
+    }
+    if (inverse) {
+        const std::uint32_t scale = power_mod_prime<P>(std::uint32_t(n % P), P - 2);
+        for (auto& x : a) {
+            x = std::uint32_t(std::uint64_t(x) * scale % P);
+        }
+    }
+}
+
+// (a * b)[0:limit), where a and b are coefficient vectors without trailing zeros
+template<std::uint32_t P>
+std::vector<std::uint32_t> polynomial_multiply(const std::vector<std::uint32_t>& a,
+                                               const std::vector<std::uint32_t>& b,
+                                               std::size_t limit) {
+    if (a.empty() || b.empty() || limit == 0) {
+        return {};
+    }
+    const std::size_t na = std::min(a.size(), limit);
+    const std::size_t nb = std::min(b.size(), limit);
+    limit = std::min(limit, na + nb - 1);
+    std::vector<std::uint32_t> out;
+    const std::size_t shorter = std::min(na, nb);
+    if (std::min(shorter, limit) < polynomial_karatsuba_threshold) {
+        // includes products truncated to a few coefficients, computed directly
+        out.resize(limit);
+        polynomial_schoolbook<P>(a.data(), na, b.data(), nb, out.data(), limit);
+    } else if (shorter < polynomial_ntt_threshold ||
+               na + nb - 1 > (std::size_t(1) << ntt_two_adicity<P>())) {
+        // products longer than the longest transform modulo P fall back to Karatsuba
+        out.resize(na + nb - 1);
+        polynomial_karatsuba<P>(a.data(), na, b.data(), nb, out.data());
+    } else {
+        std::size_t size = 1;
+        while (size < na + nb - 1) {
+            size <<= 1;
+        }
+        out.assign(a.begin(), a.begin() + na);
+        out.resize(size);
+        ntt<P>(out, false);
+        if (&a == &b) {
+            // squaring needs a single forward transform
+            for (auto& x : out) {
+                x = std::uint32_t(std::uint64_t(x) * x % P);
+            }
+        } else {
+            std::vector<std::uint32_t> fb(b.begin(), b.begin() + nb);
+            fb.resize(size);
+            ntt<P>(fb, false);
+            for (std::size_t i = 0; i < size; ++i) {
+                out[i] = std::uint32_t(std::uint64_t(out[i]) * fb[i] % P);
+            }
+        }
+        ntt<P>(out, true);
+    }
+    out.resize(limit);
+    while (!out.empty() && out.back() == 0) {
+        out.pop_back();
+    }
+    return out;
+}
+}  // namespace detail
+
+/*! \brief Polynomial with coefficients modulo the prime \a P.
+ *
+ *  \a P must be an NTT-friendly prime below 2^31, i.e. P - 1 must be divisible by a large power
+ *  of two (998244353 = 119 * 2^23 + 1 is the usual choice), at least 2^9. Products longer than
+ *  that power are computed with Karatsuba instead of the transform. Coefficients are stored
+ *  lowest degree first without trailing zeros, the zero polynomial has no coefficients.
+ */
+template<std::uint32_t P> class polynomial_mod {
+    static_assert(P > 2 && P < (std::uint32_t(1) << 31), "unsupported modulus");
+    static_assert(detail::ntt_two_adicity<P>() >= detail::polynomial_ntt_min_log_size,
+                  "modulus is not NTT-friendly");
+
+    std::vector<std::uint32_t> m_coefficients;
+
+    void trim() {
+        while (!m_coefficients.empty() && m_coefficients.back() == 0) {
+            m_coefficients.pop_back();
+        }
+    }
+
+public:
+    static constexpr std::uint32_t modulus = P;
+
+    polynomial_mod() = default;
+    polynomial_mod(std::vector<std::uint32_t> coefficients)
+        : m_coefficients(std::move(coefficients)) {
+        for (auto& c : m_coefficients) {
+            c %= P;
+        }
+        trim();
+    }
+    polynomial_mod(std::initializer_list<std::uint32_t> coefficients)
+        : polynomial_mod(std::vector<std::uint32_t>(coefficients)) {}
+
+    // number of stored coefficients, degree + 1 for a non-zero polynomial
+    std::size_t size() const { return m_coefficients.size(); }
+    bool empty() const { return m_coefficients.empty(); }
+
+    // coefficient of x^i, zero beyond the stored ones
+    std::uint32_t operator[](std::size_t i) const {
+        return i < m_coefficients.size() ? m_coefficients[i] : 0;
+    }
+    const std::vector<std::uint32_t>& coefficients() const { return m_coefficients; }
+
+    friend bool operator==(const polynomial_mod& a, const polynomial_mod& b) {
+        return a.m_coefficients == b.m_coefficients;
+    }
+    friend bool operator!=(const polynomial_mod& a, const polynomial_mod& b) { return !(a == b); }
+
+    friend polynomial_mod operator+(const polynomial_mod& a, const polynomial_mod& b) {
+        std::vector<std::uint32_t> sum(std::max(a.size(), b.size()));
+        for (std::size_t i = 0; i < sum.size(); ++i) {
+            sum[i] = detail::add_mod_prime<P>(a[i], b[i]);
+        }
+        return polynomial_mod(std::move(sum));
+    }
+
+    /*! \brief Returns (a * b) mod x^\a limit.
+     */
+    friend polynomial_mod multiply_truncated(const polynomial_mod& a, const polynomial_mod& b,
+                                             std::size_t limit) {
+        polynomial_mod product;
+        product.m_coefficients =
+            detail::polynomial_multiply<P>(a.m_coefficients, b.m_coefficients, limit);
+        return product;
+    }
+
+    friend polynomial_mod operator*(const polynomial_mod& a, const polynomial_mod& b) {
+        return multiply_truncated(a, b, std::numeric_limits<std::size_t>::max());
+    }
+};
+
+template<std::uint32_t P>
+polynomial_mod<P> identity_element(std::multiplies<polynomial_mod<P>>) {
+    return polynomial_mod<P>{1};
+}
+
+/*! \brief Multiplication of polynomial_mod objects modulo x^\a limit (truncated power series).
+ *
+ *  power_monoid with this operation computes the first \a limit coefficients of a power while
+ *  keeping every intermediate result at most \a limit coefficients long. Operands are cut to
+ *  \a limit coefficients before a product; only the schoolbook path stops at \a limit, the
+ *  Karatsuba and NTT paths form the full product of up to 2 * \a limit - 1 coefficients and
+ *  truncate it afterwards.
+ */
+template<std::uint32_t P> class polynomial_mod_multiplies {
+    std::size_t m_limit = 0;
+
+public:
+    explicit polynomial_mod_multiplies(std::size_t limit) : m_limit(limit) {}
+
+    std::size_t limit() const { return m_limit; }
+
+    polynomial_mod<P> operator()(const polynomial_mod<P>& a, const polynomial_mod<P>& b) const {
+        return multiply_truncated(a, b, m_limit);
+    }
+
+    friend polynomial_mod<P> identity_element(const polynomial_mod_multiplies& op) {
+        return op.m_limit == 0 ? polynomial_mod<P>{} : polynomial_mod<P>{1};
+    }
+};
+
+}  // namespace clsc
@@ -0,0 +1,163 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include "group_theory_bits.hpp"
+#include "parallel_bits.hpp"
+#include "simd_bits.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+/**
+ * \file reduce.hpp
+ * \brief File defines reductions (folds) over semigroup and monoid operations. Associativity of
+ * the operation allows to split the range between threads, partial results are combined in the
+ * original order, so operations are not required to be commutative.
+ */
+namespace clsc {
+
+namespace detail {
+template<typename InputIt, typename Regular, typename SemigroupOperation>
+Regular reduce_sequential(InputIt first, InputIt last, Regular init, SemigroupOperation& op) {
+    for (; first != last; ++first) {
+        init = op(init, *first);
+    }
+    return init;
+}
+
+// commutativity allows to keep independent accumulators for every fourth element, so that
+// latency-bound operations overlap
+template<typename RandomIt, typename Regular, typename SemigroupOperation>
+Regular reduce_interleaved(RandomIt first, RandomIt last, Regular init, SemigroupOperation& op) {
+    if (last - first < 8) {
+        return reduce_sequential(first, last, init, op);
+    }
+    Regular acc1 = first[0];
+    Regular acc2 = first[1];
+    Regular acc3 = first[2];
+    for (first += 3; last - first >= 4; first += 4) {
+        init = op(init, first[0]);
+        acc1 = op(acc1, first[1]);
+        acc2 = op(acc2, first[2]);
+        acc3 = op(acc3, first[3]);
+    }
+    init = op(op(init, acc1), op(acc2, acc3));
+    return reduce_sequential(first, last, init, op);
+}
+
+#if defined(CLSC_VECTOR_EXTENSIONS)
+template<typename T, typename Op> T reduce_simd(const T* first, const T* last, T init, Op op) {
+    constexpr std::ptrdiff_t lanes = simd_lanes<T>;
+    simd_vector<T> acc = simd_broadcast(simd_identity<T>(op));
+    for (; last - first >= lanes; first += lanes) {
+        acc = simd_apply(op, acc, simd_load(first));
+    }
+    for (std::ptrdiff_t i = 0; i < lanes; ++i) {
+        init = op(init, acc[i]);
+    }
+    return reduce_sequential(first, last, init, op);
+}
+#endif
+
+template<typename InputIt, typename Regular, typename SemigroupOperation>
+Regular reduce_block(InputIt first, InputIt last, Regular init, SemigroupOperation& op) {
+#if defined(CLSC_VECTOR_EXTENSIONS)
+    if constexpr (is_simd_operation_v<SemigroupOperation, Regular> &&
+                  is_contiguous_iterator_v<InputIt>) {
+        if (first == last) {
+            return init;
+        }
+        const Regular* in = &*first;
+        return reduce_simd(in, in + (last - first), init, op);
+    }
+#endif
+    if constexpr (is_commutative_v<SemigroupOperation>) {
+        return reduce_interleaved(first, last, init, op);
+    }
+    return reduce_sequential(first, last, init, op);
+}
+
+// every chunk is reduced on its own thread starting from its first element, partial results are
+// then combined left to right
+template<typename RandomIt, typename SemigroupOperation>
+typename std::iterator_traits<RandomIt>::value_type
+reduce_nonempty(RandomIt first, RandomIt last, SemigroupOperation& op, std::size_t threads) {
+    using Regular = typename std::iterator_traits<RandomIt>::value_type;
+    const std::size_t n = std::size_t(last - first);
+    const std::size_t workers = worker_count(n, threads, parallel_min_chunk);
+    if (workers == 1) {
+        return reduce_block(first + 1, last, Regular(*first), op);
+    }
+
+    std::vector<Regular> partials(workers, *first);
+    parallel_invoke_n(workers, [&](std::size_t i) {
+        SemigroupOperation local_op = op;
+        const auto bounds = chunk_bounds(n, workers, i);
+        partials[i] = reduce_block(first + bounds.first + 1, first + bounds.second,
+                                   Regular(first[bounds.first]), local_op);
+    });
+    Regular result = partials[0];
+    for (std::size_t i = 1; i < workers; ++i) {
+        result = op(result, partials[i]);
+    }
+    return result;
+}
+}  // namespace detail
+
+/*! \brief Computes x[0] op x[1] op ... op x[n - 1] for the non-empty range x = [first, last).
+ *
+ *  Long ranges are split between \a threads threads (0 means one per hardware thread). std::plus,
+ *  std::multiplies, minimum and maximum over contiguous ranges of arithmetic types are
+ *  additionally vectorized, other operations marked by is_commutative are reduced with several
+ *  interleaved accumulators.
+ */
+template<typename RandomIt, typename SemigroupOperation>
+typename std::iterator_traits<RandomIt>::value_type
+reduce_semigroup(RandomIt first, RandomIt last, SemigroupOperation op, std::size_t threads = 0) {
+    assert(first != last);
+    return detail::reduce_nonempty(first, last, op, threads);
+}
+
+/*! \brief Same as reduce_semigroup, but the range may be empty: identity_element(op) is returned
+ *         then.
+ */
+template<typename RandomIt, typename MonoidOperation>
+typename std::iterator_traits<RandomIt>::value_type
+reduce_monoid(RandomIt first, RandomIt last, MonoidOperation op, std::size_t threads = 0) {
+    if (first == last) {
+        using clsc::detail::identity_element;
+        return identity_element(op);
+    }
+    return detail::reduce_nonempty(first, last, op, threads);
+}
+
+}  // namespace clsc
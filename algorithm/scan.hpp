@@ -0,0 +1,179 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include "group_theory_bits.hpp"
+#include "parallel_bits.hpp"
+#include "reduce.hpp"
+#include "simd_bits.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+/**
+ * \file scan.hpp
+ * \brief File defines prefix scans over monoid operations. Associativity of the operation allows
+ * to split the range between threads, the order of operands is always preserved, so operations
+ * are not required to be commutative.
+ */
+namespace clsc {
+
+namespace detail {
+template<bool Inclusive, typename InputIt, typename OutputIt, typename Regular,
+         typename MonoidOperation>
+OutputIt scan_sequential(InputIt first, InputIt last, OutputIt d_first, Regular carry,
+                         MonoidOperation& op) {
+    for (; first != last; ++first, ++d_first) {
+        if constexpr (Inclusive) {
+            carry = op(carry, *first);
+            *d_first = carry;
+        } else {
+            Regular value = *first;  // input and output may alias
+            *d_first = carry;
+            carry = op(carry, value);
+        }
+    }
+    return d_first;
+}
+
+#if defined(CLSC_VECTOR_EXTENSIONS)
+// in-register prefix: log2(lanes) shift-and-combine steps
+template<std::size_t Shift, typename T, typename Op>
+simd_vector<T> simd_prefix(simd_vector<T> x, simd_vector<T> identity, Op op) {
+    if constexpr (Shift < simd_lanes<T>) {
+        using lane_indices = std::make_index_sequence<simd_lanes<T>>;
+        x = simd_apply(op, x, simd_shift_up<Shift>(x, identity, lane_indices{}));
+        return simd_prefix<2 * Shift, T>(x, identity, op);
+    } else {
+        return x;
+    }
+}
+
+template<bool Inclusive, typename T, typename Op>
+T* scan_simd(const T* first, const T* last, T* d_first, T carry, Op op) {
+    constexpr std::ptrdiff_t lanes = simd_lanes<T>;
+    using lane_indices = std::make_index_sequence<simd_lanes<T>>;
+    const simd_vector<T> identity = simd_broadcast(simd_identity<T>(op));
+    simd_vector<T> carries = simd_broadcast(carry);
+    for (; last - first >= lanes; first += lanes, d_first += lanes) {
+        const simd_vector<T> inclusive =
+            simd_apply(op, carries, simd_prefix<1, T>(simd_load(first), identity, op));
+        if constexpr (Inclusive) {
+            simd_store(d_first, inclusive);
+        } else {
+            simd_store(d_first, simd_shift_up<1>(inclusive, carries, lane_indices{}));
+        }
+        carries = simd_broadcast_last(inclusive, lane_indices{});
+    }
+    return scan_sequential<Inclusive>(first, last, d_first, T(carries[0]), op);
+}
+#endif
+
+template<bool Inclusive, typename InputIt, typename OutputIt, typename Regular,
+         typename MonoidOperation>
+OutputIt scan_block(InputIt first, InputIt last, OutputIt d_first, Regular carry,
+                    MonoidOperation& op) {
+#if defined(CLSC_VECTOR_EXTENSIONS)
+    if constexpr (is_simd_operation_v<MonoidOperation, Regular> &&
+                  is_contiguous_iterator_v<InputIt> && is_contiguous_iterator_v<OutputIt> &&
+                  std::is_same<typename std::iterator_traits<OutputIt>::value_type,
+                               Regular>::value) {
+        if (first == last) {
+            return d_first;
+        }
+        const auto n = last - first;
+        const Regular* in = &*first;
+        scan_simd<Inclusive>(in, in + n, &*d_first, carry, op);
+        return d_first + n;
+    }
+#endif
+    return scan_sequential<Inclusive>(first, last, d_first, carry, op);
+}
+
+// two-pass blocked scan: chunk reductions in parallel, a short sequential scan of chunk
+// reductions, then independent chunk scans seeded with the preceding chunks' product
+template<bool Inclusive, typename RandomIt, typename RandomOutputIt, typename MonoidOperation>
+RandomOutputIt monoid_scan(RandomIt first, RandomIt last, RandomOutputIt d_first,
+                           MonoidOperation op, std::size_t threads) {
+    using Regular = typename std::iterator_traits<RandomIt>::value_type;
+    using clsc::detail::identity_element;
+    const Regular identity = identity_element(op);
+    const std::size_t n = std::size_t(last - first);
+    const std::size_t workers = worker_count(n, threads, parallel_min_chunk);
+    if (workers == 1) {
+        return scan_block<Inclusive>(first, last, d_first, identity, op);
+    }
+
+    std::vector<Regular> carries(workers, identity);
+    parallel_invoke_n(workers - 1, [&](std::size_t i) {
+        MonoidOperation local_op = op;
+        const auto bounds = chunk_bounds(n, workers, i);
+        carries[i + 1] =
+            reduce_block(first + bounds.first, first + bounds.second, identity, local_op);
+    });
+    for (std::size_t i = 2; i < workers; ++i) {
+        carries[i] = op(carries[i - 1], carries[i]);
+    }
+    parallel_invoke_n(workers, [&](std::size_t i) {
+        MonoidOperation local_op = op;
+        const auto bounds = chunk_bounds(n, workers, i);
+        scan_block<Inclusive>(first + bounds.first, first + bounds.second, d_first + bounds.first,
+                              carries[i], local_op);
+    });
+    return d_first + n;
+}
+}  // namespace detail
+
+/*! \brief Computes d_first[i] = x[0] op x[1] op ... op x[i] for the range x = [first, last).
+ *
+ *  Long ranges are split between \a threads threads (0 means one per hardware thread). std::plus
+ *  and std::multiplies over contiguous ranges of arithmetic types are additionally vectorized.
+ *  The output range must be random access and may coincide with the input. Returns the end of
+ *  the output range.
+ */
+template<typename RandomIt, typename RandomOutputIt, typename MonoidOperation>
+RandomOutputIt monoid_inclusive_scan(RandomIt first, RandomIt last, RandomOutputIt d_first,
+                                     MonoidOperation op, std::size_t threads = 0) {
+    return detail::monoid_scan<true>(first, last, d_first, op, threads);
+}
+
+/*! \brief Computes d_first[i] = e op x[0] op ... op x[i - 1] for the range x = [first, last),
+ *         where e is identity_element(op).
+ *
+ *  Same as monoid_inclusive_scan otherwise.
+ */
+template<typename RandomIt, typename RandomOutputIt, typename MonoidOperation>
+RandomOutputIt monoid_exclusive_scan(RandomIt first, RandomIt last, RandomOutputIt d_first,
+                                     MonoidOperation op, std::size_t threads = 0) {
+    return detail::monoid_scan<false>(first, last, d_first, op, threads);
+}
+
+}  // namespace clsc
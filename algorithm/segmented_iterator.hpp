@@ -0,0 +1,86 @@
+// Copyright 2020 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <type_traits>
+
+/**
+ * \file segmented_iterator.hpp
+ * \brief File defines traits of segmented iterators, which traverse a sequence stored as a series
+ * of contiguous segments (e.g. the blocks of std::deque). Algorithms use them to run a tight loop
+ * over each segment instead of checking for the end of a segment on every increment, following
+ * M. Austern, "Segmented Iterators and Hierarchical Algorithms".
+ */
+namespace clsc {
+
+/*! \brief Segmented iterator traits, to be specialized by users for their own chunked containers.
+ *
+ *  A specialization derives from std::true_type and provides:
+ *    - segment_iterator, which steps over the segments with ++ and is equality comparable;
+ *    - local_iterator, which steps within one segment (ideally a pointer, then the contiguous
+ *      kernels of the algorithms apply to each segment);
+ *    - static segment(it) and local(it), the segment of \a it and the position of \a it in it;
+ *    - static begin(segment) and end(segment), the local range of a segment;
+ *    - static compose(segment, local), the iterator at a local position of a segment.
+ *  An iterator equal to the end of a segment may also be represented by the beginning of the
+ *  next one, so local(it) is in [begin(segment(it)), end(segment(it))].
+ */
+template<typename It> struct segmented_iterator_traits : std::false_type {};
+
+template<typename It>
+constexpr bool is_segmented_iterator_v = segmented_iterator_traits<It>::value;
+
+#if defined(__GLIBCXX__)
+// iterators of std::deque with the standard allocator: segments are the blocks pointed to by the
+// deque's map of blocks, all of them _S_buffer_size() elements long
+template<typename T, typename Reference, typename Pointer>
+struct segmented_iterator_traits<std::_Deque_iterator<T, Reference, Pointer>>
+    : std::integral_constant<bool, std::is_same<Pointer, T*>::value ||
+                                       std::is_same<Pointer, const T*>::value> {
+    using iterator = std::_Deque_iterator<T, Reference, Pointer>;
+    using segment_iterator = typename iterator::_Map_pointer;
+    using local_iterator = Pointer;
+
+    static segment_iterator segment(const iterator& it) { return it._M_node; }
+    static local_iterator local(const iterator& it) { return it._M_cur; }
+
+    static local_iterator begin(segment_iterator segment) { return *segment; }
+    static local_iterator end(segment_iterator segment) {
+        return *segment + iterator::_S_buffer_size();
+    }
+
+    static iterator compose(segment_iterator segment, local_iterator local) {
+        return iterator(const_cast<typename iterator::_Elt_pointer>(local), segment);
+    }
+};
+#endif
+
+}  // namespace clsc
@@ -0,0 +1,171 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include "group_theory_bits.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// CLSC_VECTOR_EXTENSIONS is defined when compiler vector extensions (GCC/Clang vector_size
+// types with __builtin_shufflevector) are available. The vectors are lowered to whatever
+// instruction set the translation unit is compiled for, e.g. SSE2 by default and AVX2 with
+// -mavx2.
+#if defined(__GNUC__) && defined(__has_builtin)
+#if __has_builtin(__builtin_shufflevector)
+#define CLSC_VECTOR_EXTENSIONS 1
+#endif
+#endif
+
+// CLSC_X86_SIMD is defined when vector extensions target x86, where kernels may additionally be
+// compiled for AVX2 with the target attribute and selected at run time with cpu_has_avx2()
+#if defined(CLSC_VECTOR_EXTENSIONS) && (defined(__x86_64__) || defined(__i386__))
+#define CLSC_X86_SIMD 1
+#endif
+
+namespace clsc {
+namespace detail {
+
+#if defined(__AVX2__)
+constexpr std::size_t simd_bytes = 32;
+#else
+constexpr std::size_t simd_bytes = 16;
+#endif
+
+// iterators of std::basic_string<T>, which exists only for the standard character types
+template<typename It, typename T,
+         bool = std::is_same<T, char>::value || std::is_same<T, wchar_t>::value ||
+                std::is_same<T, char16_t>::value || std::is_same<T, char32_t>::value>
+struct is_string_iterator : std::false_type {};
+template<typename It, typename T>
+struct is_string_iterator<It, T, true>
+    : std::integral_constant<
+          bool, std::is_same<It, typename std::basic_string<T>::iterator>::value ||
+                    std::is_same<It, typename std::basic_string<T>::const_iterator>::value> {};
+
+// iterators over contiguous storage that can be safely turned into pointers: pointers and the
+// iterators of std::vector (except std::vector<bool>) and std::basic_string
+template<typename It, typename T = typename std::iterator_traits<It>::value_type,
+         typename = void>
+struct is_contiguous_iterator : std::is_pointer<It> {};
+template<typename It, typename T>
+struct is_contiguous_iterator<It, T,
+                              std::enable_if_t<std::is_object<T>::value &&
+                                               !std::is_pointer<It>::value &&
+                                               !std::is_same<T, bool>::value>>
+    : std::integral_constant<
+          bool, std::is_same<It, typename std::vector<T>::iterator>::value ||
+                    std::is_same<It, typename std::vector<T>::const_iterator>::value ||
+                    is_string_iterator<It, T>::value> {};
+template<typename It> constexpr bool is_contiguous_iterator_v = is_contiguous_iterator<It>::value;
+
+// arithmetic types for which vector kernels exist
+template<typename T>
+constexpr bool is_simd_arithmetic_v = std::is_arithmetic<T>::value && !std::is_same<T, bool>::value;
+
+// std::plus and std::multiplies applied to \a T (or their transparent versions)
+template<typename Op, typename T>
+constexpr bool is_simd_plus_v =
+    std::is_same<Op, std::plus<T>>::value || std::is_same<Op, std::plus<>>::value;
+template<typename Op, typename T>
+constexpr bool is_simd_multiplies_v =
+    std::is_same<Op, std::multiplies<T>>::value || std::is_same<Op, std::multiplies<>>::value;
+template<typename Op, typename T>
+constexpr bool is_simd_min_max_v =
+    std::is_same<Op, minimum<T>>::value || std::is_same<Op, maximum<T>>::value;
+template<typename Op, typename T>
+constexpr bool is_simd_operation_v =
+    is_simd_arithmetic_v<T> &&
+    (is_simd_plus_v<Op, T> || is_simd_multiplies_v<Op, T> || is_simd_min_max_v<Op, T>);
+
+#if defined(CLSC_VECTOR_EXTENSIONS)
+template<typename T> using simd_vector __attribute__((vector_size(simd_bytes))) = T;
+template<typename T> constexpr std::size_t simd_lanes = simd_bytes / sizeof(T);
+
+template<typename T> simd_vector<T> simd_load(const T* p) {
+    simd_vector<T> v;
+    __builtin_memcpy(&v, p, sizeof(v));
+    return v;
+}
+template<typename T, typename V> void simd_store(T* p, V v) {
+    static_assert(sizeof(V) == simd_bytes, "unexpected vector type");
+    __builtin_memcpy(p, &v, sizeof(v));
+}
+template<typename T> simd_vector<T> simd_broadcast(T x) { return simd_vector<T>{} + x; }
+
+// lanes of \a x moved up by \a Shift positions, vacated lanes are taken from \a fill
+template<std::size_t Shift, typename V, std::size_t... I>
+V simd_shift_up(V x, V fill, std::index_sequence<I...>) {
+    return __builtin_shufflevector(x, fill, (I >= Shift ? I - Shift : sizeof...(I) + I)...);
+}
+
+template<typename V, std::size_t... I> V simd_broadcast_last(V x, std::index_sequence<I...>) {
+    return __builtin_shufflevector(x, x, (I * 0 + sizeof...(I) - 1)...);
+}
+
+template<typename T, typename V> V simd_apply(std::plus<T>, V a, V b) { return a + b; }
+template<typename T, typename V> V simd_apply(std::multiplies<T>, V a, V b) { return a * b; }
+template<typename V> V simd_apply(std::plus<>, V a, V b) { return a + b; }
+template<typename V> V simd_apply(std::multiplies<>, V a, V b) { return a * b; }
+template<typename T, typename V> V simd_apply(minimum<T>, V a, V b) { return b < a ? b : a; }
+template<typename T, typename V> V simd_apply(maximum<T>, V a, V b) { return a < b ? b : a; }
+
+template<typename T, typename Op> T simd_identity(Op op) {
+    if constexpr (is_simd_plus_v<Op, T>) {
+        return T(0);
+    } else if constexpr (is_simd_multiplies_v<Op, T>) {
+        return T(1);
+    } else {
+        return identity_element(op);
+    }
+}
+#endif
+
+#if defined(CLSC_X86_SIMD)
+// whether the running processor supports AVX2, queried once
+inline bool cpu_has_avx2() {
+#if defined(__AVX2__)
+    return true;
+#else
+    static const bool supported = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return supported;
+#endif
+}
+#endif
+
+}  // namespace detail
+}  // namespace clsc
@@ -0,0 +1,193 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include "dense_matrix.hpp"
+#include "matrix.hpp"
+#include "simd_bits.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+/**
+ * \file tropical.hpp
+ * \brief File defines matrix multiplication in the tropical (min, +) semiring. Raising a matrix
+ * of edge weights to the power h with power_semigroup gives shortest paths of at most h edges.
+ */
+namespace clsc {
+
+/*! \brief The "no edge" value of the tropical semiring.
+ *
+ *  Floating point types use +infinity. Integers use half of their maximum, so that the sum of
+ *  two infinities does not overflow; products saturate every sum with an infinite operand to
+ *  it, so edge weights may be negative. Finite path lengths must stay below it in absolute value.
+ */
+template<typename T> constexpr T tropical_infinity() {
+    if constexpr (std::numeric_limits<T>::has_infinity) {
+        return std::numeric_limits<T>::infinity();
+    } else {
+        return std::numeric_limits<T>::max() / 2;
+    }
+}
+
+namespace detail {
+// element-wise minimum of scalars or compiler vectors
+template<typename V> V tropical_min(V x, V y) { return x < y ? x : y; }
+
+// (min, +) semiring policy for dense_multiply, see plus_times_semiring
+template<typename T> struct min_plus_semiring {
+    static constexpr T zero() { return tropical_infinity<T>(); }
+    // a + b, or infinity when either operand is infinite: an integer infinity plus a negative
+    // weight would otherwise become a finite value
+    template<typename V> static V times(V a, V b) {
+        if constexpr (std::numeric_limits<T>::has_infinity) {
+            return a + b;
+        } else {
+            const V infinity = V{} + zero();
+            const V larger = a < b ? b : a;
+            return larger < infinity ? a + b : infinity;
+        }
+    }
+    template<typename V> static V multiply_add(V acc, V a, V b) {
+        return tropical_min(acc, times(a, b));
+    }
+    template<typename V> static V add(V x, V y) { return tropical_min(x, y); }
+    template<typename V> static V normalize(V x) {
+        if constexpr (std::numeric_limits<T>::has_infinity) {
+            return x;
+        } else {
+            // values above infinity given by the caller are infinity again
+            return tropical_min(x, V{} + zero());
+        }
+    }
+};
+
+template<typename T, std::size_t N>
+void tropical_matrix_multiply(Matrix<T, N>& c, const Matrix<T, N>& a, const Matrix<T, N>& b) {
+    using semiring = min_plus_semiring<T>;
+    constexpr std::size_t stride = Matrix<T, N>::stride;
+#if defined(CLSC_VECTOR_EXTENSIONS)
+    if constexpr (is_matrix_simd_v<T>) {
+        // c[i, :] = min over k of a[i, k] + b[k, :], a row of c stays in registers
+        constexpr std::size_t vectors = stride / simd_lanes<T>;
+        for (std::size_t i = 0; i < N; ++i) {
+            simd_vector<T> row[vectors];
+            for (std::size_t v = 0; v < vectors; ++v) {
+                row[v] = simd_broadcast(semiring::zero());
+            }
+            for (std::size_t k = 0; k < N; ++k) {
+                const simd_vector<T> aik = simd_broadcast(a(i, k));
+                for (std::size_t v = 0; v < vectors; ++v) {
+                    row[v] = semiring::multiply_add(row[v], aik,
+                                                    simd_load(&b(k, 0) + v * simd_lanes<T>));
+                }
+            }
+            for (std::size_t v = 0; v < vectors; ++v) {
+                simd_store(&c(i, 0) + v * simd_lanes<T>, semiring::normalize(row[v]));
+            }
+            // padding is always zero
+            for (std::size_t j = N; j < stride; ++j) {
+                c(i, j) = T(0);
+            }
+        }
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+            T value = semiring::zero();
+            for (std::size_t k = 0; k < N; ++k) {
+                value = semiring::multiply_add(value, a(i, k), b(k, j));
+            }
+            c(i, j) = semiring::normalize(value);
+        }
+    }
+}
+}  // namespace detail
+
+/*! \brief Matrix product in the (min, +) semiring: c(i, j) = min over k of a(i, k) + b(k, j).
+ *
+ *  Specialized for Matrix<T, N> and dense_matrix<T>. The identity_element has 0 on the diagonal
+ *  and tropical_infinity<T>() elsewhere.
+ */
+template<typename MatrixType> class tropical_multiplies;
+
+template<typename T, std::size_t N> class tropical_multiplies<Matrix<T, N>> {
+public:
+    Matrix<T, N> operator()(const Matrix<T, N>& a, const Matrix<T, N>& b) const {
+        Matrix<T, N> c;
+        detail::tropical_matrix_multiply(c, a, b);
+        return c;
+    }
+
+    friend Matrix<T, N> identity_element(tropical_multiplies) {
+        Matrix<T, N> m;
+        for (std::size_t i = 0; i < N; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                m(i, j) = i == j ? T(0) : tropical_infinity<T>();
+            }
+        }
+        return m;
+    }
+};
+
+/*! \brief Blocked, multi-threaded (min, +) product of dense_matrix objects, with the same
+ *         kernel structure, buffer reuse and parameters as dense_matrix_multiplies.
+ */
+template<typename T> class tropical_multiplies<dense_matrix<T>> {
+    std::size_t m_order = 0;
+    std::size_t m_threads = 0;
+    mutable detail::dense_buffers<T> m_buffers;
+
+public:
+    explicit tropical_multiplies(std::size_t order = 0, std::size_t threads = 0)
+        : m_order(order), m_threads(threads) {}
+
+    // c = a * b, c must not alias a or b
+    void operator()(dense_matrix<T>& c, const dense_matrix<T>& a, const dense_matrix<T>& b) const {
+        detail::dense_multiply<detail::min_plus_semiring<T>>(c, a, b, m_threads, m_buffers);
+    }
+
+    dense_matrix<T> operator()(const dense_matrix<T>& a, const dense_matrix<T>& b) const {
+        dense_matrix<T> c;
+        (*this)(c, a, b);
+        return c;
+    }
+
+    friend dense_matrix<T> identity_element(const tropical_multiplies& op) {
+        dense_matrix<T> m(op.m_order, op.m_order, tropical_infinity<T>());
+        for (std::size_t i = 0; i < op.m_order; ++i) {
+            m(i, i) = T(0);
+        }
+        return m;
+    }
+};
+
+}  // namespace clsc
@@ -0,0 +1,143 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "common.hpp"
+#include "heap_matrix.hpp"
+
+#include <algorithm.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+// 4x4 matrix product modulo a prime - an operation expensive enough for op count to matter
+struct matrix4_mod {
+    std::uint64_t e[16] = {};
+};
+
+struct matrix4_mod_multiplies {
+    static constexpr std::uint64_t modulus = 1000000007;
+    std::uint64_t* counter = nullptr;
+    matrix4_mod operator()(const matrix4_mod& a, const matrix4_mod& b) const {
+        ++*counter;
+        matrix4_mod c;
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                std::uint64_t sum = 0;
+                for (int k = 0; k < 4; ++k) {
+                    sum = (sum + a.e[i * 4 + k] * b.e[k * 4 + j]) % modulus;
+                }
+                c.e[i * 4 + j] = sum;
+            }
+        }
+        return c;
+    }
+};
+}  // namespace
+
+BENCHMARK(power, binary_vs_sliding_window) {
+    std::mt19937_64 generator{};
+    std::vector<std::uint64_t> exponents(20000);
+    for (auto& n : exponents) {
+        n = generator() | (std::uint64_t(1) << 63);
+    }
+    matrix4_mod a;
+    for (auto& e : a.e) {
+        e = generator() % matrix4_mod_multiplies::modulus;
+    }
+
+    std::uint64_t binary_ops = 0;
+    const double binary = bench_common::measure(
+        [&]() {
+            for (auto n : exponents) {
+                bench_common::do_not_optimize(
+                    clsc::power_semigroup(a, n, matrix4_mod_multiplies{&binary_ops}));
+            }
+        },
+        1);
+    bench_common::report("power_semigroup", binary, double(exponents.size()), "pow");
+
+    std::uint64_t window_ops = 0;
+    const double window = bench_common::measure(
+        [&]() {
+            for (auto n : exponents) {
+                bench_common::do_not_optimize(
+                    clsc::power_semigroup_window(a, n, matrix4_mod_multiplies{&window_ops}));
+            }
+        },
+        1);
+    bench_common::report("power_semigroup_window<auto>", window, double(exponents.size()), "pow");
+    std::printf("  op calls per power: binary %.2f, sliding window %.2f\n",
+                double(binary_ops) / exponents.size(), double(window_ops) / exponents.size());
+}
+
+namespace {
+using heap_matrix = tests_common::heap_matrix<double>;
+using heap_matrix_multiplies = tests_common::heap_matrix_multiplies<double>;
+using heap_matrix_multiplies_plain = tests_common::heap_matrix_multiplies_plain<double>;
+}  // namespace
+
+BENCHMARK(power, output_operation_protocol) {
+    heap_matrix a(16);
+    for (std::size_t i = 0; i < 16; ++i) {
+        a.data()[i * 16 + i] = 1.0;
+        a.data()[i * 16 + (i + 1) % 16] = 1e-3;
+    }
+    const std::uint64_t n = 0xffffffffull;  // 31 squarings and 31 multiplications
+    const int repeats = 2000;
+    const double steps = 62.0 * repeats;
+
+    heap_matrix::allocations = 0;
+    const double plain = bench_common::measure(
+        [&]() {
+            for (int i = 0; i < repeats; ++i) {
+                bench_common::do_not_optimize(
+                    clsc::power_semigroup(a, n, heap_matrix_multiplies_plain{}).data()[0]);
+            }
+        },
+        1);
+    bench_common::report("power_semigroup, op(lhs, rhs)", plain, steps, "step");
+    std::printf("    allocations per step: %.3f\n", heap_matrix::allocations / steps);
+
+    heap_matrix::allocations = 0;
+    const double in_place = bench_common::measure(
+        [&]() {
+            for (int i = 0; i < repeats; ++i) {
+                bench_common::do_not_optimize(
+                    clsc::power_semigroup(a, n, heap_matrix_multiplies{}).data()[0]);
+            }
+        },
+        1);
+    bench_common::report("power_semigroup, op(out, lhs, rhs)", in_place, steps, "step");
+    std::printf("    allocations per step: %.3f (%.1f per power, independent of n)\n",
+                heap_matrix::allocations / steps, double(heap_matrix::allocations) / repeats);
+}
@@ -0,0 +1,79 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "common.hpp"
+
+#include <algorithm.hpp>
+#include <batch_power.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+template<typename T>
+void batch_power_benchmark(const char* type, const std::vector<T>& bases, std::uint64_t n) {
+    std::vector<T> out(bases.size());
+    const double items = double(bases.size());
+    const std::string suffix = std::string("<") + type + ">, n = " + std::to_string(n);
+
+    const double scalar = bench_common::measure([&]() {
+        for (std::size_t i = 0; i < bases.size(); ++i) {
+            out[i] = clsc::power_monoid(bases[i], n, std::multiplies<T>{});
+        }
+        bench_common::do_not_optimize(out[0]);
+    });
+    bench_common::report(("power_monoid loop" + suffix).c_str(), scalar, items, "elem");
+
+    const double batch = bench_common::measure([&]() {
+        clsc::power_monoid_n(bases.begin(), bases.end(), out.begin(), n, std::multiplies<T>{});
+        bench_common::do_not_optimize(out[0]);
+    });
+    bench_common::report(("power_monoid_n" + suffix).c_str(), batch, items, "elem");
+    std::printf("    speedup over scalar loop: %.2fx\n", scalar / batch);
+}
+}  // namespace
+
+BENCHMARK(batch_power, shared_exponent) {
+    std::mt19937_64 generator{};
+    std::uniform_real_distribution<double> distribution(1 - 1e-10, 1 + 1e-10);
+    std::vector<double> doubles(1 << 20);
+    std::vector<float> floats(doubles.size());
+    std::vector<std::uint32_t> integers(doubles.size());
+    for (std::size_t i = 0; i < doubles.size(); ++i) {
+        doubles[i] = distribution(generator);
+        floats[i] = float(doubles[i]);
+        integers[i] = std::uint32_t(generator());
+    }
+    for (std::uint64_t n : {1000ull, 1000000007ull}) {
+        batch_power_benchmark("double", doubles, n);
+        batch_power_benchmark("float", floats, n);
+        batch_power_benchmark("uint32_t", integers, n);
+    }
+}
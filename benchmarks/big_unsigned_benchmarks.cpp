@@ -0,0 +1,79 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "common.hpp"
+
+#include <big_unsigned.hpp>
+#include <fibonacci.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+BENCHMARK(big_unsigned, multiplication) {
+    using namespace clsc::detail;
+    std::mt19937 generator{};
+    for (std::size_t n : {64, 256, 1024, 4096, 16384}) {
+        std::vector<std::uint32_t> a(n), b(n), out(2 * n);
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = generator();
+            b[i] = generator();
+        }
+        const std::string suffix = ", " + std::to_string(n) + " limbs";
+        if (n <= 4096) {
+            const double schoolbook = bench_common::measure([&]() {
+                big_schoolbook<big_binary_base>(a.data(), n, b.data(), n, out.data());
+                bench_common::do_not_optimize(out[0]);
+            });
+            bench_common::report(("schoolbook" + suffix).c_str(), schoolbook, double(n), "limb");
+        }
+        const double multiply = bench_common::measure([&]() {
+            big_multiply<big_binary_base>(a.data(), n, b.data(), n, out.data());
+            bench_common::do_not_optimize(out[0]);
+        });
+        bench_common::report(("big_multiply" + suffix).c_str(), multiply, double(n), "limb");
+        const double ntt = bench_common::measure([&]() {
+            big_multiply_ntt<big_binary_base>(a.data(), n, b.data(), n, out.data());
+            bench_common::do_not_optimize(out[0]);
+        });
+        bench_common::report(("transform only" + suffix).c_str(), ntt, double(n), "limb");
+    }
+}
+
+BENCHMARK(big_unsigned, fibonacci_big) {
+    for (std::uint64_t n : {100000ull, 1000000ull, 10000000ull}) {
+        clsc::big_unsigned f;
+        const double compute = bench_common::measure([&]() { f = clsc::fibonacci_big(n); }, 1);
+        const double digits = double(f.bit_length()) * 0.30103;
+        const std::string suffix = ", n = " + std::to_string(n);
+        bench_common::report(("fibonacci_big" + suffix).c_str(), compute, digits, "digit");
+        std::string s;
+        const double decimal = bench_common::measure([&]() { s = f.to_string(); }, 1);
+        bench_common::report(("to_string" + suffix).c_str(), decimal, double(s.size()), "digit");
+    }
+}
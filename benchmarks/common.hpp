@@ -0,0 +1,85 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+namespace bench_common {
+using benchmark_function = void (*)();
+
+struct benchmark_entry {
+    const char* suite;
+    const char* name;
+    benchmark_function run;
+};
+
+inline std::vector<benchmark_entry>& registry() {
+    static std::vector<benchmark_entry> entries;
+    return entries;
+}
+
+struct registrar {
+    registrar(const char* suite, const char* name, benchmark_function run) {
+        registry().push_back({suite, name, run});
+    }
+};
+
+// prevents the compiler from optimizing the computation of \a value away
+template<typename T> void do_not_optimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// returns the best wall-clock time of \a repeats runs of \a f, in seconds
+template<typename Function> double measure(Function&& f, int repeats = 5) {
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < repeats; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double>(end - start).count());
+    }
+    return best;
+}
+
+// prints \a seconds spent on \a items units of work as time and throughput
+inline void report(const char* what, double seconds, double items, const char* unit = "op") {
+    std::printf("  %-48s %10.3f ms %12.3f M%s/s\n", what, seconds * 1e3, items / seconds / 1e6,
+                unit);
+}
+}  // namespace bench_common
+
+#define BENCHMARK(suite, name)                                                                     \
+    static void suite##_##name();                                                                  \
+    static const bench_common::registrar suite##_##name##_registrar(#suite, #name,                 \
+                                                                    suite##_##name);               \
+    static void suite##_##name()
@@ -0,0 +1,205 @@
+// Copyright 2020 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "common.hpp"
+
+#include <count_until.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace {
+// scans \a values whose only hit is the last element with an opaque lambda, with the recognized
+// predicate and, where available, with each vector kernel; throughput is in bytes
+template<typename T, typename Predicate>
+void count_until_benchmark(const std::string& what, const std::vector<T>& values, Predicate p) {
+    const double bytes = double(values.size() * sizeof(T));
+    const auto opaque = [p](const T& x) { return p(x); };
+    const double scalar = bench_common::measure([&]() {
+        bench_common::do_not_optimize(
+            clsc::count_until(values.begin(), values.end(), opaque).second);
+    });
+    bench_common::report(("lambda, " + what).c_str(), scalar, bytes, "B");
+    const double simd = bench_common::measure([&]() {
+        bench_common::do_not_optimize(clsc::count_until(values.begin(), values.end(), p).second);
+    });
+    bench_common::report(("predicate, " + what).c_str(), simd, bytes, "B");
+#if defined(CLSC_VECTOR_EXTENSIONS)
+    const double narrow = bench_common::measure([&]() {
+        bench_common::do_not_optimize(
+            clsc::detail::count_until_default(values.data(), values.size(), p));
+    });
+    bench_common::report(("default kernel, " + what).c_str(), narrow, bytes, "B");
+#endif
+#if defined(CLSC_X86_SIMD) && !defined(__AVX2__)
+    if (clsc::detail::cpu_has_avx2()) {
+        const double wide = bench_common::measure([&]() {
+            bench_common::do_not_optimize(
+                clsc::detail::count_until_avx2(values.data(), values.size(), p));
+        });
+        bench_common::report(("avx2 kernel, " + what).c_str(), wide, bytes, "B");
+    }
+#endif
+}
+}  // namespace
+
+BENCHMARK(count_until, sentinel) {
+    // a buffer that stays in cache and one far beyond it
+    for (const std::size_t bytes : {std::size_t(1) << 14, std::size_t(1) << 28}) {
+        const std::string suffix = std::to_string(bytes >> 10) + " KiB";
+        std::vector<char> text(bytes, 'a');
+        text.back() = '\n';
+        count_until_benchmark("char == '\\n', " + suffix, text, clsc::equal_to_value<char>('\n'));
+        text.clear();
+        text.shrink_to_fit();
+
+        std::vector<std::int32_t> ints(bytes / sizeof(std::int32_t), 100);
+        ints.back() = -1;
+        count_until_benchmark("int32 < 0, " + suffix, ints, clsc::less_than<std::int32_t>(0));
+        ints.clear();
+        ints.shrink_to_fit();
+
+        std::vector<float> floats(bytes / sizeof(float), 0.5f);
+        floats.back() = 2.0f;
+        count_until_benchmark("float > 1, " + suffix, floats,
+                              clsc::greater_than<float>(1.0f));
+    }
+}
+
+BENCHMARK(count_until, parallel) {
+    const std::size_t count = std::size_t(1) << 25;
+    std::vector<std::int32_t> values(count, 100);
+    const auto opaque = [](std::int32_t x) { return x < 0; };
+    const std::size_t hardware = clsc::detail::hardware_threads();
+    for (const std::size_t hit : {count / 100, count - count / 100, count}) {
+        if (hit < count) {
+            values[hit] = -1;
+        }
+        const std::string suffix = hit == count      ? ", no match"
+                                   : hit < count / 2 ? ", match at 1%"
+                                                     : ", match at 99%";
+        // throughput counts the elements up to the match
+        const double scanned = double(std::min(hit + 1, count));
+        const double sequential = bench_common::measure([&]() {
+            bench_common::do_not_optimize(
+                clsc::count_until(values.begin(), values.end(), opaque).second);
+        });
+        bench_common::report(("sequential lambda" + suffix).c_str(), sequential, scanned, "elem");
+        for (const std::size_t threads : {std::size_t(2), hardware}) {
+            const double parallel = bench_common::measure([&]() {
+                bench_common::do_not_optimize(
+                    clsc::count_until(values.begin(), values.end(), opaque, threads).second);
+            });
+            bench_common::report(
+                (std::to_string(threads) + " threads, lambda" + suffix).c_str(), parallel,
+                scanned, "elem");
+        }
+        const double vectorized = bench_common::measure([&]() {
+            bench_common::do_not_optimize(
+                clsc::count_until(values.begin(), values.end(), clsc::less_than<std::int32_t>(0),
+                                  hardware)
+                    .second);
+        });
+        bench_common::report(
+            (std::to_string(hardware) + " threads, less_than" + suffix).c_str(), vectorized,
+            scanned, "elem");
+        if (hit < count) {
+            values[hit] = 100;
+        }
+    }
+}
+
+BENCHMARK(count_until, deque) {
+    // a deque that stays in cache and one far beyond it
+    for (const std::size_t count : {std::size_t(1) << 12, std::size_t(1) << 24}) {
+        std::deque<std::int32_t> values(count, 100);
+        values.back() = -1;
+        const auto opaque = [](std::int32_t x) { return x < 0; };
+        const double items = double(count);
+        const std::string suffix = ", " + std::to_string(count) + " elements";
+        // the generic loop, paying for the block boundary check on every increment
+        const double element = bench_common::measure([&]() {
+            std::ptrdiff_t n = 0;
+            for (auto it = values.begin(); it != values.end() && !opaque(*it); ++it, ++n) {
+            }
+            bench_common::do_not_optimize(n);
+        });
+        bench_common::report(("element loop, lambda" + suffix).c_str(), element, items, "elem");
+        const double find = bench_common::measure([&]() {
+            bench_common::do_not_optimize(std::find_if(values.begin(), values.end(), opaque));
+        });
+        bench_common::report(("std::find_if, lambda" + suffix).c_str(), find, items, "elem");
+        const double segmented = bench_common::measure([&]() {
+            bench_common::do_not_optimize(
+                clsc::count_until(values.begin(), values.end(), opaque).second);
+        });
+        bench_common::report(("count_until, lambda" + suffix).c_str(), segmented, items, "elem");
+        const double vectorized = bench_common::measure([&]() {
+            bench_common::do_not_optimize(
+                clsc::count_until(values.begin(), values.end(), clsc::less_than<std::int32_t>(0))
+                    .second);
+        });
+        bench_common::report(("count_until, less_than" + suffix).c_str(), vectorized, items,
+                             "elem");
+    }
+}
+
+BENCHMARK(count_until, guarded) {
+    // a buffer that stays in cache and one far beyond it, the terminator is the last element
+    for (const std::size_t count : {std::size_t(1) << 12, std::size_t(1) << 24}) {
+        std::vector<std::int32_t> values(count, 100);
+        values.back() = -1;
+        const auto opaque = [](std::int32_t x) { return x < 0; };
+        const double items = double(count);
+        const std::string suffix = ", " + std::to_string(count) + " elements";
+        const double bounded = bench_common::measure([&]() {
+            bench_common::do_not_optimize(
+                clsc::count_until(values.begin(), values.end(), opaque).second);
+        });
+        bench_common::report(("bounded" + suffix).c_str(), bounded, items, "elem");
+        const double unbounded = bench_common::measure([&]() {
+            bench_common::do_not_optimize(
+                clsc::count_until(values.begin(), clsc::unreachable_sentinel, opaque).second);
+        });
+        bench_common::report(("unreachable_sentinel" + suffix).c_str(), unbounded, items, "elem");
+        const double guarded = bench_common::measure([&]() {
+            bench_common::do_not_optimize(
+                clsc::count_until_guarded(values.begin(), values.end(), opaque, -1).second);
+        });
+        bench_common::report(("count_until_guarded" + suffix).c_str(), guarded, items, "elem");
+        const double vectorized = bench_common::measure([&]() {
+            bench_common::do_not_optimize(
+                clsc::count_until(values.begin(), values.end(), clsc::less_than<std::int32_t>(0))
+                    .second);
+        });
+        bench_common::report(("bounded, less_than" + suffix).c_str(), vectorized, items, "elem");
+    }
+}
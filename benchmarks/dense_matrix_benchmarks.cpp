@@ -0,0 +1,115 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "common.hpp"
+
+#include <algorithm.hpp>
+#include <dense_matrix.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+
+namespace {
+template<typename T> void naive_multiply(T* c, const T* a, const T* b, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            T sum = 0;
+            for (std::size_t k = 0; k < n; ++k) {
+                sum += a[i * n + k] * b[k * n + j];
+            }
+            c[i * n + j] = sum;
+        }
+    }
+}
+
+// same layout as bench_common::report, in GFLOP/s
+void report_gflops(const std::string& what, double seconds, double flops) {
+    std::printf("  %-48s %10.3f ms %12.3f GFLOP/s\n", what.c_str(), seconds * 1e3,
+                flops / seconds / 1e9);
+}
+
+template<typename T> void dense_multiply_benchmark(const char* type, std::size_t n) {
+    std::mt19937 generator{};
+    clsc::dense_matrix<T> a(n, n), b(n, n), c(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            a(i, j) = T(generator() % 16);
+            b(i, j) = T(generator() % 16);
+        }
+    }
+    const double flops = 2.0 * double(n) * double(n) * double(n);
+    const std::string suffix = std::string(", ") + type + ", n = " + std::to_string(n);
+
+    const double naive = bench_common::measure(
+        [&]() {
+            naive_multiply(c.data(), a.data(), b.data(), n);
+            bench_common::do_not_optimize(c(0, 0));
+        },
+        1);
+    report_gflops("naive triple loop" + suffix, naive, flops);
+
+    const clsc::dense_matrix_multiplies<T> op;
+    const double blocked = bench_common::measure(
+        [&]() {
+            op(c, a, b);
+            bench_common::do_not_optimize(c(0, 0));
+        },
+        3);
+    report_gflops("dense_matrix_multiplies" + suffix, blocked, flops);
+}
+}  // namespace
+
+BENCHMARK(dense_matrix, multiply) {
+    dense_multiply_benchmark<double>("double", 256);
+    dense_multiply_benchmark<double>("double", 512);
+    dense_multiply_benchmark<std::uint64_t>("uint64", 512);
+}
+
+BENCHMARK(dense_matrix, power_semigroup) {
+    // a stochastic matrix raised to 2^10 - 1: 9 squarings and 9 products
+    const std::size_t n = 512;
+    std::mt19937 generator{};
+    clsc::dense_matrix<double> transitions(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            transitions(i, j) = double(generator() % 16 + 1) / (8.5 * double(n));
+        }
+    }
+    const int exponent = 1023;
+    const double flops = 18.0 * 2.0 * double(n) * double(n) * double(n);
+    const double seconds = bench_common::measure(
+        [&]() {
+            const auto p = clsc::power_semigroup(transitions, exponent,
+                                                 clsc::dense_matrix_multiplies<double>{});
+            bench_common::do_not_optimize(p(0, 0));
+        },
+        1);
+    report_gflops("power_semigroup<dense_matrix>, n = 512, 2^10 - 1", seconds, flops);
+}
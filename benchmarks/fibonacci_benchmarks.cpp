@@ -0,0 +1,163 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "common.hpp"
+
+#include <algorithm.hpp>
+#include <fibonacci.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+// the 2x2 Fibonacci matrix modulo m with 128-bit products, the baseline for fibonacci_mod
+struct matrix_mod {
+    std::uint64_t e[4] = {1, 0, 0, 1};
+};
+struct matrix_mod_multiplies {
+    std::uint64_t m;
+    std::uint64_t dot(std::uint64_t a, std::uint64_t b, std::uint64_t c, std::uint64_t d) const {
+        using Wide = unsigned __int128;
+        return std::uint64_t((Wide(a) * b % m + Wide(c) * d % m) % m);
+    }
+    matrix_mod operator()(const matrix_mod& a, const matrix_mod& b) const {
+        return {{dot(a.e[0], b.e[0], a.e[1], b.e[2]), dot(a.e[0], b.e[1], a.e[1], b.e[3]),
+                 dot(a.e[2], b.e[0], a.e[3], b.e[2]), dot(a.e[2], b.e[1], a.e[3], b.e[3])}};
+    }
+};
+matrix_mod identity_element(matrix_mod_multiplies) { return {}; }
+
+std::uint64_t fibonacci_matrix_mod(std::uint64_t n, std::uint64_t m) {
+    const matrix_mod q{{1 % m, 1 % m, 1 % m, 0}};
+    return clsc::power_monoid(q, n, matrix_mod_multiplies{m}).e[1];
+}
+
+template<typename Function>
+void fibonacci_benchmark(const std::string& what, const std::vector<std::uint64_t>& ns,
+                         Function f) {
+    const double seconds = bench_common::measure([&]() {
+        std::uint64_t sum = 0;
+        for (std::uint64_t n : ns) {
+            sum += f(n);
+        }
+        bench_common::do_not_optimize(sum);
+    });
+    bench_common::report(what.c_str(), seconds, double(ns.size()), "query");
+}
+}  // namespace
+
+BENCHMARK(fibonacci, wrapping) {
+    std::mt19937_64 generator{};
+    std::vector<std::uint64_t> ns(1 << 18);
+    for (auto& n : ns) {
+        n = std::uint32_t(generator());
+    }
+    fibonacci_benchmark("fibonacci_matrix, 32-bit n", ns,
+                        [](std::uint64_t n) { return clsc::fibonacci_matrix(std::uint32_t(n)); });
+    fibonacci_benchmark("fibonacci, fast doubling, 32-bit n", ns,
+                        [](std::uint64_t n) { return clsc::fibonacci(n); });
+}
+
+BENCHMARK(fibonacci, modulo) {
+    std::mt19937_64 generator{};
+    std::vector<std::uint64_t> ns(1 << 16);
+    for (auto& n : ns) {
+        n = generator();
+    }
+    for (std::uint64_t m : {1000000007ull, 0xffffffffffffffc5ull, 1000000000000000000ull}) {
+        const std::string suffix = ", 64-bit n, m = " + std::to_string(m);
+        fibonacci_benchmark("matrix power" + suffix, ns,
+                            [m](std::uint64_t n) { return fibonacci_matrix_mod(n, m); });
+        fibonacci_benchmark("fibonacci_mod" + suffix, ns,
+                            [m](std::uint64_t n) { return clsc::fibonacci_mod(n, m); });
+    }
+}
+
+BENCHMARK(fibonacci, batch) {
+    std::mt19937_64 generator{};
+    const std::size_t count = 1 << 20;
+    std::vector<std::uint32_t> uniform(count);
+    std::vector<std::uint32_t> mixed(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        uniform[i] = std::uint32_t(generator());
+        // log-uniform magnitudes, a quarter of them served from the table
+        mixed[i] = std::uint32_t(generator() >> (32 + generator() % 32));
+    }
+    std::vector<std::uint64_t> out(count);
+    for (const auto* ns : {&uniform, &mixed}) {
+        const std::string suffix = ns == &uniform ? ", uniform 32-bit n" : ", log-uniform n";
+        const double matrix = bench_common::measure([&]() {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = clsc::fibonacci_matrix((*ns)[i]);
+            }
+            bench_common::do_not_optimize(out[0]);
+        });
+        bench_common::report(("fibonacci_matrix loop" + suffix).c_str(), matrix, double(count),
+                             "query");
+        const double scalar = bench_common::measure([&]() {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = clsc::fibonacci((*ns)[i]);
+            }
+            bench_common::do_not_optimize(out[0]);
+        });
+        bench_common::report(("fibonacci loop" + suffix).c_str(), scalar, double(count), "query");
+        const double batch = bench_common::measure([&]() {
+            clsc::fibonacci_batch(ns->begin(), ns->end(), out.begin());
+            bench_common::do_not_optimize(out[0]);
+        });
+        bench_common::report(("fibonacci_batch" + suffix).c_str(), batch, double(count), "query");
+    }
+}
+
+BENCHMARK(fibonacci, range) {
+    // a buffer that stays in cache and one far beyond it
+    for (const std::size_t count : {std::size_t(1) << 12, std::size_t(1) << 24}) {
+        const std::uint64_t a = 1000000;
+        std::vector<std::uint64_t> out(count);
+        const std::string suffix = ", " + std::to_string(count) + " values";
+        const double scalar = bench_common::measure([&]() {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = clsc::fibonacci(a + i);
+            }
+            bench_common::do_not_optimize(out[0]);
+        });
+        bench_common::report(("fibonacci loop" + suffix).c_str(), scalar, double(count), "value");
+        const double range = bench_common::measure([&]() {
+            std::copy(clsc::fibonacci_range(a, a + count - 1).begin(),
+                      clsc::fibonacci_range(a, a + count - 1).end(), out.begin());
+            bench_common::do_not_optimize(out[0]);
+        });
+        bench_common::report(("fibonacci_range" + suffix).c_str(), range, double(count), "value");
+        const double fill = bench_common::measure([&]() {
+            clsc::fibonacci_fill(out.begin(), a, count);
+            bench_common::do_not_optimize(out[0]);
+        });
+        bench_common::report(("fibonacci_fill" + suffix).c_str(), fill, double(count), "value");
+    }
+}
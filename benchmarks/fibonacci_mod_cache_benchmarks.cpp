@@ -0,0 +1,86 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "common.hpp"
+
+#include <fibonacci.hpp>
+#include <fibonacci_mod_cache.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+BENCHMARK(fibonacci_mod_cache, recurring_moduli) {
+    std::mt19937_64 generator{};
+    const std::uint64_t moduli[] = {1000, 65536, 999983, 1000000};
+    std::vector<std::uint64_t> ns(1 << 20);
+    std::vector<std::uint64_t> ms(ns.size());
+    for (std::size_t i = 0; i < ns.size(); ++i) {
+        ns[i] = generator();
+        ms[i] = moduli[generator() % 4];
+    }
+    const double items = double(ns.size());
+
+    const double direct = bench_common::measure([&]() {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < ns.size(); ++i) {
+            sum += clsc::fibonacci_mod(ns[i], ms[i]);
+        }
+        bench_common::do_not_optimize(sum);
+    });
+    bench_common::report("fibonacci_mod, 4 moduli", direct, items, "query");
+
+    clsc::fibonacci_mod_cache cache;
+    const double first = bench_common::measure([&]() {
+        for (std::uint64_t m : moduli) {
+            bench_common::do_not_optimize(cache(0, m));
+        }
+    }, 1);
+    double tabulated = 0;
+    for (std::uint64_t m : moduli) {
+        tabulated += double(clsc::pisano_period(m));
+    }
+    bench_common::report("fibonacci_mod_cache, tabulating 4 moduli", first, tabulated, "elem");
+    const double cached = bench_common::measure([&]() {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < ns.size(); ++i) {
+            sum += cache(ns[i], ms[i]);
+        }
+        bench_common::do_not_optimize(sum);
+    });
+    bench_common::report("fibonacci_mod_cache, 4 moduli", cached, items, "query");
+}
+
+BENCHMARK(fibonacci_mod_cache, pisano_period) {
+    for (std::uint64_t m : {1000000007ull, 4294967291ull * 4294967279ull, 0xffffffffffffffc5ull}) {
+        const double seconds = bench_common::measure(
+            [&]() { bench_common::do_not_optimize(clsc::pisano_period(m)); });
+        bench_common::report(("pisano_period, m = " + std::to_string(m)).c_str(), seconds, 1.0,
+                             "period");
+    }
+}
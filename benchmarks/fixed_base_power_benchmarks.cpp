@@ -0,0 +1,80 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "common.hpp"
+
+#include <algorithm.hpp>
+#include <fixed_base_power.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+struct multiplies_mod {
+    std::uint64_t m = 0xffffffffffffffc5ull;  // largest 64-bit prime
+    std::uint64_t operator()(std::uint64_t a, std::uint64_t b) const {
+        return std::uint64_t((unsigned __int128)a * b % m);
+    }
+};
+std::uint64_t identity_element(multiplies_mod) { return 1; }
+
+std::vector<std::uint64_t> random_exponents(std::size_t count) {
+    std::mt19937_64 generator{};
+    std::vector<std::uint64_t> exponents(count);
+    for (auto& n : exponents) {
+        n = generator();
+    }
+    return exponents;
+}
+}  // namespace
+
+BENCHMARK(fixed_base_power, power_monoid_vs_table) {
+    const auto exponents = random_exponents(200000);
+    const std::uint64_t base = 3;
+    const multiplies_mod op{};
+
+    const double plain = bench_common::measure([&]() {
+        for (auto n : exponents) {
+            bench_common::do_not_optimize(clsc::power_monoid(base, n, op));
+        }
+    });
+    bench_common::report("power_monoid", plain, double(exponents.size()), "pow");
+
+    for (std::size_t window : {1, 4, 8}) {
+        const clsc::fixed_base_power<std::uint64_t, multiplies_mod> power(base, op, 64, window);
+        const double fixed = bench_common::measure([&]() {
+            for (auto n : exponents) {
+                bench_common::do_not_optimize(power(n));
+            }
+        });
+        const std::string what = "fixed_base_power, window " + std::to_string(window);
+        bench_common::report(what.c_str(), fixed, double(exponents.size()), "pow");
+    }
+}
@@ -0,0 +1,128 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "common.hpp"
+
+#include <algorithm.hpp>
+#include <linear_recurrence.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+const std::uint64_t modulus = 998244353;
+
+// k x k companion matrix powering, the O(k^3 log n) baseline
+struct companion_multiplies {
+    std::size_t k = 0;
+    std::vector<std::uint64_t> operator()(const std::vector<std::uint64_t>& a,
+                                          const std::vector<std::uint64_t>& b) const {
+        std::vector<std::uint64_t> c(k * k);
+        for (std::size_t i = 0; i < k; ++i) {
+            for (std::size_t l = 0; l < k; ++l) {
+                const std::uint64_t ail = a[i * k + l];
+                for (std::size_t j = 0; j < k; ++j) {
+                    c[i * k + j] = (c[i * k + j] + ail * b[l * k + j]) % modulus;
+                }
+            }
+        }
+        return c;
+    }
+};
+std::vector<std::uint64_t> identity_element(const companion_multiplies& op) {
+    std::vector<std::uint64_t> one(op.k * op.k);
+    for (std::size_t i = 0; i < op.k; ++i) {
+        one[i * op.k + i] = 1;
+    }
+    return one;
+}
+
+void linear_recurrence_benchmark(std::size_t k, bool with_matrix) {
+    std::mt19937_64 generator(k);
+    std::vector<std::uint64_t> c(k), initial(k), ns(200), out(ns.size());
+    for (std::size_t i = 0; i < k; ++i) {
+        c[i] = generator() % modulus;
+        initial[i] = generator() % modulus;
+    }
+    for (auto& n : ns) {
+        n = generator();
+    }
+    const double items = double(ns.size());
+    const std::string suffix = ", k = " + std::to_string(k);
+
+    if (with_matrix) {
+        std::vector<std::uint64_t> companion(k * k);
+        for (std::size_t j = 0; j < k; ++j) {
+            companion[j] = c[j];
+        }
+        for (std::size_t i = 1; i < k; ++i) {
+            companion[i * k + i - 1] = 1;
+        }
+        const double matrix = bench_common::measure(
+            [&]() {
+                for (std::size_t i = 0; i < ns.size(); ++i) {
+                    // a(n) for n >= k is row k - 1 of M^(n - k + 1) applied to the initial terms
+                    const auto p = clsc::power_monoid(companion, ns[i] - k + 1,
+                                                      companion_multiplies{k});
+                    std::uint64_t sum = 0;
+                    for (std::size_t j = 0; j < k; ++j) {
+                        sum = (sum + p[j] * initial[k - 1 - j]) % modulus;
+                    }
+                    out[i] = sum;
+                }
+                bench_common::do_not_optimize(out.back());
+            },
+            1);
+        bench_common::report(("companion matrix power" + suffix).c_str(), matrix, items, "term");
+    }
+
+    const clsc::linear_recurrence<std::uint64_t> recurrence(c, initial, modulus);
+    const double single = bench_common::measure([&]() {
+        for (std::size_t i = 0; i < ns.size(); ++i) {
+            out[i] = recurrence(ns[i]);
+        }
+        bench_common::do_not_optimize(out.back());
+    });
+    bench_common::report(("linear_recurrence, one by one" + suffix).c_str(), single, items,
+                         "term");
+
+    const double batch = bench_common::measure([&]() {
+        recurrence(ns.begin(), ns.end(), out.begin());
+        bench_common::do_not_optimize(out.back());
+    });
+    bench_common::report(("linear_recurrence, batch" + suffix).c_str(), batch, items, "term");
+}
+}  // namespace
+
+BENCHMARK(linear_recurrence, nth_term) {
+    linear_recurrence_benchmark(8, true);
+    linear_recurrence_benchmark(32, true);
+    linear_recurrence_benchmark(256, false);
+}
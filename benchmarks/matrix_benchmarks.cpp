@@ -0,0 +1,102 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "common.hpp"
+
+#include <algorithm.hpp>
+#include <matrix.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace {
+// the scalar triple loop the vectorized kernel replaces
+template<typename T, std::size_t N> struct scalar_matrix {
+    T e[N][N] = {};
+};
+
+template<typename T, std::size_t N> struct scalar_matrix_multiplies {
+    scalar_matrix<T, N> operator()(const scalar_matrix<T, N>& a,
+                                   const scalar_matrix<T, N>& b) const {
+        scalar_matrix<T, N> c;
+        for (std::size_t i = 0; i < N; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                T sum = 0;
+                for (std::size_t k = 0; k < N; ++k) {
+                    sum += a.e[i][k] * b.e[k][j];
+                }
+                c.e[i][j] = sum;
+            }
+        }
+        return c;
+    }
+};
+
+template<typename T, std::size_t N> void matrix_power_benchmark(const char* type) {
+    const int repeats = 20000;
+    const std::uint64_t n = 1000003;
+    scalar_matrix<T, N> scalar;
+    clsc::Matrix<T, N> simd;
+    for (std::size_t i = 0; i < N; ++i) {
+        scalar.e[i][(i + 1) % N] = T(1);
+        simd(i, (i + 1) % N) = T(1);
+    }
+
+    const double naive = bench_common::measure(
+        [&]() {
+            for (int i = 0; i < repeats; ++i) {
+                bench_common::do_not_optimize(
+                    clsc::power_semigroup(scalar, n, scalar_matrix_multiplies<T, N>{}).e[0][0]);
+            }
+        },
+        3);
+    std::string what = "scalar triple loop, " + std::string(type) + ", N = " + std::to_string(N);
+    bench_common::report(what.c_str(), naive, repeats, "pow");
+
+    const double vectorized = bench_common::measure(
+        [&]() {
+            for (int i = 0; i < repeats; ++i) {
+                bench_common::do_not_optimize(
+                    clsc::power_semigroup(simd, n, std::multiplies<clsc::Matrix<T, N>>{})(0, 0));
+            }
+        },
+        3);
+    what = "clsc::Matrix, " + std::string(type) + ", N = " + std::to_string(N);
+    bench_common::report(what.c_str(), vectorized, repeats, "pow");
+}
+}  // namespace
+
+BENCHMARK(matrix, power_semigroup) {
+    matrix_power_benchmark<double, 4>("double");
+    matrix_power_benchmark<double, 8>("double");
+    matrix_power_benchmark<double, 12>("double");
+    matrix_power_benchmark<std::int32_t, 4>("int32");
+    matrix_power_benchmark<std::int32_t, 8>("int32");
+    matrix_power_benchmark<std::int32_t, 12>("int32");
+}
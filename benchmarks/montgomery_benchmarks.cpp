@@ -0,0 +1,82 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "common.hpp"
+
+#include <algorithm.hpp>
+#include <montgomery.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+struct multiplies_mod {
+    std::uint64_t m = 0;
+    std::uint64_t operator()(std::uint64_t a, std::uint64_t b) const {
+        return std::uint64_t((unsigned __int128)a * b % m);
+    }
+};
+std::uint64_t identity_element(multiplies_mod op) { return 1 % op.m; }
+}  // namespace
+
+BENCHMARK(montgomery, power_mod_64) {
+    const std::uint64_t modulus = 0xffffffffffffffc5ull;
+    std::mt19937_64 generator{};
+    std::vector<std::uint64_t> bases(100000), exponents(bases.size()), out(bases.size());
+    for (std::size_t i = 0; i < bases.size(); ++i) {
+        bases[i] = generator() % modulus;
+        exponents[i] = generator();
+    }
+    const double items = double(bases.size());
+
+    const multiplies_mod division{modulus};
+    const double plain = bench_common::measure([&]() {
+        for (std::size_t i = 0; i < bases.size(); ++i) {
+            out[i] = clsc::power_monoid(bases[i], exponents[i], division);
+        }
+        bench_common::do_not_optimize(out.back());
+    });
+    bench_common::report("power_monoid, 128-bit division", plain, items, "pow");
+
+    const clsc::montgomery_multiplies<std::uint64_t> montgomery(modulus);
+    const double scalar = bench_common::measure([&]() {
+        for (std::size_t i = 0; i < bases.size(); ++i) {
+            out[i] = clsc::montgomery_power(bases[i], exponents[i], montgomery);
+        }
+        bench_common::do_not_optimize(out.back());
+    });
+    bench_common::report("montgomery_power", scalar, items, "pow");
+
+    const double batch = bench_common::measure([&]() {
+        clsc::montgomery_power_batch(bases.begin(), bases.end(), exponents.begin(), out.begin(),
+                                     montgomery);
+        bench_common::do_not_optimize(out.back());
+    });
+    bench_common::report("montgomery_power_batch<8>", batch, items, "pow");
+}
@@ -0,0 +1,73 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "common.hpp"
+
+#include <algorithm.hpp>
+#include <permutation.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+clsc::permutation random_permutation(std::size_t n) {
+    std::mt19937 generator{};
+    std::vector<clsc::permutation::index_type> images(n);
+    std::iota(images.begin(), images.end(), 0u);
+    std::shuffle(images.begin(), images.end(), generator);
+    return clsc::permutation(images);
+}
+}  // namespace
+
+BENCHMARK(permutation, power) {
+    const std::uint64_t k = 0xfedcba9876543210ull;
+    const clsc::permutation_compose op;
+    for (std::size_t n : {1000000, 10000000}) {
+        const clsc::permutation a = random_permutation(n);
+        const std::string suffix = ", n = " + std::to_string(n) + ", 64-bit k";
+        if (n <= 1000000) {
+            const double generic = bench_common::measure(
+                [&]() {
+                    const auto p = clsc::detail::power_accumulate_semigroup(clsc::permutation(n),
+                                                                            a, k, op);
+                    bench_common::do_not_optimize(p[0]);
+                },
+                1);
+            bench_common::report(("repeated composition" + suffix).c_str(), generic, double(n),
+                                 "elem");
+        }
+        const double cycles = bench_common::measure(
+            [&]() { bench_common::do_not_optimize(clsc::power_group(a, k, op)[0]); }, 3);
+        bench_common::report(("power_group, cycle rotation" + suffix).c_str(), cycles, double(n),
+                             "elem");
+    }
+}
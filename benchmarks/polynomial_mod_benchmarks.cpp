@@ -0,0 +1,95 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "common.hpp"
+
+#include <algorithm.hpp>
+#include <polynomial_mod.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr std::uint32_t prime = 998244353;
+using polynomial = clsc::polynomial_mod<prime>;
+
+polynomial random_polynomial(std::size_t size, std::mt19937& generator) {
+    std::vector<std::uint32_t> coefficients(size);
+    for (auto& c : coefficients) {
+        c = generator() % prime;
+    }
+    return polynomial(coefficients);
+}
+
+// quadratic product, the method power_monoid is limited by without fast multiplication
+polynomial schoolbook(const polynomial& a, const polynomial& b) {
+    std::vector<std::uint32_t> c(a.size() + b.size() - 1);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        for (std::size_t j = 0; j < b.size(); ++j) {
+            c[i + j] = std::uint32_t((c[i + j] + std::uint64_t(a[i]) * b[j]) % prime);
+        }
+    }
+    return polynomial(c);
+}
+}  // namespace
+
+BENCHMARK(polynomial_mod, multiply) {
+    std::mt19937 generator{};
+    for (std::size_t size : {64, 512, 4096, 32768}) {
+        const polynomial a = random_polynomial(size, generator);
+        const polynomial b = random_polynomial(size, generator);
+        const std::string suffix = ", n = " + std::to_string(size);
+        const double items = double(size);
+        if (size <= 4096) {
+            const double naive = bench_common::measure(
+                [&]() { bench_common::do_not_optimize(schoolbook(a, b)[0]); }, 3);
+            bench_common::report(("schoolbook" + suffix).c_str(), naive, items, "coef");
+        }
+        const double fast =
+            bench_common::measure([&]() { bench_common::do_not_optimize((a * b)[0]); }, 3);
+        bench_common::report(("polynomial_mod operator*" + suffix).c_str(), fast, items, "coef");
+    }
+}
+
+BENCHMARK(polynomial_mod, truncated_power) {
+    // first 2^16 coefficients of a generating function raised to a 64-bit power
+    std::mt19937 generator{};
+    const std::size_t limit = std::size_t(1) << 16;
+    const polynomial base = random_polynomial(1000, generator);
+    const clsc::polynomial_mod_multiplies<prime> op(limit);
+    const double seconds = bench_common::measure(
+        [&]() {
+            bench_common::do_not_optimize(
+                clsc::power_monoid(base, std::uint64_t(0x123456789abcdefull), op)[0]);
+        },
+        1);
+    bench_common::report("power_monoid mod x^65536, 60-bit exponent", seconds, double(limit),
+                         "coef");
+}
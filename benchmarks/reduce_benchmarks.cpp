@@ -0,0 +1,112 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "common.hpp"
+
+#include <fibonacci.hpp>
+#include <montgomery.hpp>
+#include <parallel_bits.hpp>
+#include <reduce.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+BENCHMARK(reduce, matrix_threads) {
+    using clsc::detail::Matrix2x2;
+    const std::vector<Matrix2x2> values(1 << 24, Matrix2x2{1, 1, 1, 0});
+    const double items = double(values.size());
+
+    const double accumulate = bench_common::measure([&]() {
+        bench_common::do_not_optimize(std::accumulate(values.begin(), values.end(),
+                                                      Matrix2x2{1, 0, 0, 1},
+                                                      std::multiplies<Matrix2x2>{}));
+    });
+    bench_common::report("std::accumulate<Matrix2x2>", accumulate, items, "elem");
+
+    // scaling from 1 thread to all hardware threads
+    const std::size_t max_threads = clsc::detail::hardware_threads();
+    for (std::size_t threads = 1; threads <= max_threads;
+         threads = threads == max_threads ? threads + 1 : std::min(2 * threads, max_threads)) {
+        const double reduce = bench_common::measure([&]() {
+            bench_common::do_not_optimize(clsc::reduce_monoid(
+                values.begin(), values.end(), std::multiplies<Matrix2x2>{}, threads));
+        });
+        const std::string what =
+            "reduce_monoid<Matrix2x2>, " + std::to_string(threads) + " threads";
+        bench_common::report(what.c_str(), reduce, items, "elem");
+        std::printf("    speedup over std::accumulate: %.2fx\n", accumulate / reduce);
+    }
+}
+
+BENCHMARK(reduce, commutative_montgomery) {
+    // modular products are latency-bound, commutativity lets independent accumulators overlap
+    const clsc::montgomery_multiplies<std::uint64_t> op(0xffffffffffffffc5ull);
+    std::mt19937_64 generator{};
+    std::vector<std::uint64_t> values(1 << 22);
+    for (auto& value : values) {
+        value = op.to_montgomery(generator());
+    }
+    const double items = double(values.size());
+
+    const double accumulate = bench_common::measure([&]() {
+        bench_common::do_not_optimize(
+            std::accumulate(values.begin(), values.end(), identity_element(op), op));
+    });
+    bench_common::report("std::accumulate<montgomery_multiplies>", accumulate, items, "elem");
+
+    const double reduce = bench_common::measure([&]() {
+        bench_common::do_not_optimize(clsc::reduce_semigroup(values.begin(), values.end(), op, 1));
+    });
+    bench_common::report("reduce_semigroup, interleaved, 1 thread", reduce, items, "elem");
+}
+
+BENCHMARK(reduce, minimum) {
+    std::mt19937 generator{};
+    std::vector<std::int32_t> values(1 << 24);
+    for (auto& value : values) {
+        value = std::int32_t(generator());
+    }
+    const double items = double(values.size());
+
+    const double min_element = bench_common::measure([&]() {
+        bench_common::do_not_optimize(*std::min_element(values.begin(), values.end()));
+    });
+    bench_common::report("std::min_element<int32_t>", min_element, items, "elem");
+
+    const double reduce = bench_common::measure([&]() {
+        bench_common::do_not_optimize(clsc::reduce_semigroup(values.begin(), values.end(),
+                                                             clsc::minimum<std::int32_t>{}, 1));
+    });
+    bench_common::report("reduce_semigroup<minimum>, 1 thread", reduce, items, "elem");
+}
@@ -0,0 +1,82 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "common.hpp"
+
+#include <fibonacci.hpp>
+#include <parallel_bits.hpp>
+#include <scan.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+BENCHMARK(scan, arithmetic_simd) {
+    std::vector<float> values(1 << 24, 1.0f);
+    std::vector<float> out(values.size());
+    const double items = double(values.size());
+
+    const double partial_sum = bench_common::measure([&]() {
+        std::partial_sum(values.begin(), values.end(), out.begin());
+        bench_common::do_not_optimize(out.back());
+    });
+    bench_common::report("std::partial_sum<float>", partial_sum, items, "elem");
+
+    const double scan = bench_common::measure([&]() {
+        clsc::monoid_inclusive_scan(values.begin(), values.end(), out.begin(),
+                                    std::plus<float>{}, 1);
+        bench_common::do_not_optimize(out.back());
+    });
+    bench_common::report("monoid_inclusive_scan<float>, 1 thread", scan, items, "elem");
+}
+
+BENCHMARK(scan, matrix_threads) {
+    using clsc::detail::Matrix2x2;
+    std::vector<Matrix2x2> values(1 << 23, Matrix2x2{1, 1, 1, 0});
+    std::vector<Matrix2x2> out(values.size());
+    const double items = double(values.size());
+
+    const double partial_sum = bench_common::measure([&]() {
+        std::partial_sum(values.begin(), values.end(), out.begin(), std::multiplies<Matrix2x2>{});
+        bench_common::do_not_optimize(out.back());
+    });
+    bench_common::report("std::partial_sum<Matrix2x2>", partial_sum, items, "elem");
+
+    for (std::size_t threads = 1; threads <= clsc::detail::hardware_threads(); threads *= 2) {
+        const double scan = bench_common::measure([&]() {
+            clsc::monoid_inclusive_scan(values.begin(), values.end(), out.begin(),
+                                        std::multiplies<Matrix2x2>{}, threads);
+            bench_common::do_not_optimize(out.back());
+        });
+        const std::string what =
+            "monoid_inclusive_scan<Matrix2x2>, " + std::to_string(threads) + " threads";
+        bench_common::report(what.c_str(), scan, items, "elem");
+    }
+}
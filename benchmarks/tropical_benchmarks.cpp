@@ -0,0 +1,95 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "common.hpp"
+
+#include <algorithm.hpp>
+#include <tropical.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+
+namespace {
+// straightforward scalar min-plus product
+template<typename T> void naive_min_plus(T* c, const T* a, const T* b, std::size_t n) {
+    const T infinity = clsc::tropical_infinity<T>();
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            T best = infinity;
+            for (std::size_t k = 0; k < n; ++k) {
+                best = std::min(best, T(a[i * n + k] + b[k * n + j]));
+            }
+            c[i * n + j] = std::min(best, infinity);
+        }
+    }
+}
+
+// same layout as bench_common::report, in billions of (min, +) pairs per second
+void report_gops(const std::string& what, double seconds, double ops) {
+    std::printf("  %-48s %10.3f ms %12.3f Gop/s\n", what.c_str(), seconds * 1e3,
+                ops / seconds / 1e9);
+}
+
+template<typename T> void min_plus_benchmark(const char* type, std::size_t n) {
+    std::mt19937 generator{};
+    clsc::dense_matrix<T> a(n, n), b(n, n), c(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            a(i, j) = T(generator() % 1000);
+            b(i, j) = T(generator() % 1000);
+        }
+    }
+    const double ops = double(n) * double(n) * double(n);
+    const std::string suffix = std::string(", ") + type + ", n = " + std::to_string(n);
+
+    const double naive = bench_common::measure(
+        [&]() {
+            naive_min_plus(c.data(), a.data(), b.data(), n);
+            bench_common::do_not_optimize(c(0, 0));
+        },
+        1);
+    report_gops("scalar min-plus" + suffix, naive, ops);
+
+    const clsc::tropical_multiplies<clsc::dense_matrix<T>> op;
+    const double blocked = bench_common::measure(
+        [&]() {
+            op(c, a, b);
+            bench_common::do_not_optimize(c(0, 0));
+        },
+        3);
+    report_gops("tropical_multiplies<dense_matrix>" + suffix, blocked, ops);
+}
+}  // namespace
+
+BENCHMARK(tropical, min_plus) {
+    min_plus_benchmark<std::int32_t>("int32", 512);
+    min_plus_benchmark<float>("float", 512);
+}
@@ -29,13 +29,21 @@
 #include <algorithm.hpp>
 
 #include "common.hpp"
+#include "heap_matrix.hpp"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <functional>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <ostream>
 #include <random>
+#include <string>
+#include <utility>
 
 namespace {
 template<typename T> bool are_equal(T a, T b, int units_in_last_place = 2) {
@@ -139,3 +147,221 @@ TEST(power_tests, raise_doubles_to_power) {
         std::multiplies<double>{}, [](double v, double m) { return std::pow(v, m); }, 5, 31.0, true,
         true);
 }
+
+namespace {
+struct matrix_mod {
+    static constexpr std::uint64_t modulus = 1000000007;
+    std::uint64_t e[4] = {1, 0, 0, 1};
+
+    friend bool operator==(const matrix_mod& a, const matrix_mod& b) {
+        return std::equal(std::begin(a.e), std::end(a.e), std::begin(b.e));
+    }
+    friend std::ostream& operator<<(std::ostream& os, const matrix_mod& m) {
+        return os << "[" << m.e[0] << ", " << m.e[1] << ", " << m.e[2] << ", " << m.e[3] << "]";
+    }
+};
+
+struct matrix_mod_multiplies {
+    int* counter = nullptr;
+    matrix_mod operator()(const matrix_mod& a, const matrix_mod& b) const {
+        if (counter) {
+            ++*counter;
+        }
+        const auto m = matrix_mod::modulus;
+        return {(a.e[0] * b.e[0] + a.e[1] * b.e[2]) % m, (a.e[0] * b.e[1] + a.e[1] * b.e[3]) % m,
+                (a.e[2] * b.e[0] + a.e[3] * b.e[2]) % m, (a.e[2] * b.e[1] + a.e[3] * b.e[3]) % m};
+    }
+};
+matrix_mod identity_element(matrix_mod_multiplies) { return {}; }
+
+template<std::size_t W> void power_window_test_template() {
+    std::mt19937_64 generator{};
+    const matrix_mod a{{2, 3, 5, 7}};  // not commutative with anything interesting
+    for (int i = 0; i < 200; ++i) {
+        const std::uint64_t n = (generator() >> (i % 64)) | 1u;
+        EXPECT_EQ(clsc::power_semigroup(a, n, matrix_mod_multiplies{}),
+                  clsc::power_semigroup_window<W>(a, n, matrix_mod_multiplies{}));
+    }
+    for (int n = 0; n < 70; ++n) {
+        EXPECT_EQ(clsc::power_monoid(a, n, matrix_mod_multiplies{}),
+                  clsc::power_monoid_window<W>(a, n, matrix_mod_multiplies{}));
+        EXPECT_EQ(clsc::power_group(n, -n, std::plus<int>{}),
+                  clsc::power_group_window<W>(n, -n, std::plus<int>{}));
+    }
+}
+}  // namespace
+
+TEST(power_tests, sliding_window_matches_binary) {
+    power_window_test_template<0>();
+    power_window_test_template<1>();
+    power_window_test_template<2>();
+    power_window_test_template<3>();
+    power_window_test_template<4>();
+    power_window_test_template<6>();
+}
+
+TEST(power_tests, sliding_window_reduces_operations) {
+    std::mt19937_64 generator{};
+    const matrix_mod a{{2, 3, 5, 7}};
+    int binary_count = 0;
+    int window_count = 0;
+    for (int i = 0; i < 100; ++i) {
+        const std::uint64_t n = generator() | (std::uint64_t(1) << 63);
+        clsc::power_semigroup(a, n, matrix_mod_multiplies{&binary_count});
+        clsc::power_semigroup_window(a, n, matrix_mod_multiplies{&window_count});
+    }
+    EXPECT_LT(window_count, binary_count);
+}
+
+// the power family is usable in constant expressions
+static_assert(clsc::power_semigroup(3, 4, std::multiplies<int>{}) == 81);
+static_assert(clsc::power_monoid(3, 0, std::multiplies<int>{}) == 1);
+static_assert(clsc::power_group(3, -4, std::plus<int>{}) == -12);
+static_assert(clsc::power<5>(2, std::multiplies<int>{}) == 32);
+static_assert(clsc::power<0>(2, std::plus<int>{}) == 0);
+
+namespace {
+template<unsigned long long... Ns>
+void compile_time_power_test_template(std::integer_sequence<unsigned long long, Ns...>) {
+    const matrix_mod a{{2, 3, 5, 7}};
+    const auto expect_equal = [&](auto n, const matrix_mod& actual) {
+        EXPECT_EQ(clsc::power_monoid(a, n, matrix_mod_multiplies{}), actual) << "n = " << n;
+    };
+    (expect_equal(Ns, clsc::power<Ns>(a, matrix_mod_multiplies{})), ...);
+}
+}  // namespace
+
+TEST(power_tests, compile_time_exponent) {
+    compile_time_power_test_template(std::make_integer_sequence<unsigned long long, 65>{});
+    compile_time_power_test_template(
+        std::integer_sequence<unsigned long long, 127, 191, 255, 256, 257, 1000, 65537,
+                              0xfedcba9876543210ull>{});
+}
+
+TEST(power_tests, compile_time_exponent_uses_shortest_chain) {
+    const matrix_mod a{{2, 3, 5, 7}};
+    int counter = 0;
+    clsc::power<5>(a, matrix_mod_multiplies{&counter});
+    EXPECT_EQ(3, counter);
+    counter = 0;
+    clsc::power<15>(a, matrix_mod_multiplies{&counter});
+    EXPECT_EQ(5, counter);  // binary method takes 6
+    counter = 0;
+    clsc::power<17>(a, matrix_mod_multiplies{&counter});
+    EXPECT_EQ(5, counter);
+}
+
+namespace {
+using heap_matrix = tests_common::heap_matrix<std::uint64_t>;
+using heap_matrix_multiplies = tests_common::heap_matrix_multiplies<std::uint64_t>;
+using heap_matrix_multiplies_plain = tests_common::heap_matrix_multiplies_plain<std::uint64_t>;
+
+heap_matrix make_heap_matrix() {
+    heap_matrix m(3);
+    for (std::size_t i = 0; i < 9; ++i) {
+        m(i / 3, i % 3) = i + 1;
+    }
+    return m;
+}
+}  // namespace
+
+static_assert(clsc::detail::has_output_operation_v<heap_matrix_multiplies, heap_matrix>);
+static_assert(!clsc::detail::has_output_operation_v<heap_matrix_multiplies_plain, heap_matrix>);
+static_assert(!clsc::detail::has_output_operation_v<std::multiplies<int>, int>);
+
+TEST(power_tests, output_operation_protocol) {
+    const heap_matrix a = make_heap_matrix();
+    for (std::uint64_t n : {1u, 2u, 3u, 64u, 1000u, 123456789u}) {
+        heap_matrix::allocations = 0;
+        const heap_matrix expected = clsc::power_semigroup(a, n, heap_matrix_multiplies_plain{});
+        const int plain_allocations = heap_matrix::allocations;
+
+        heap_matrix::allocations = 0;
+        const heap_matrix actual = clsc::power_semigroup(a, n, heap_matrix_multiplies{});
+        EXPECT_TRUE(expected == actual);
+        // a fixed number of buffers, regardless of the exponent
+        EXPECT_LE(heap_matrix::allocations, 4);
+        EXPECT_LE(heap_matrix::allocations, plain_allocations + 1);
+
+        heap_matrix::allocations = 0;
+        const heap_matrix window = clsc::power_semigroup_window<3>(a, n, heap_matrix_multiplies{});
+        EXPECT_TRUE(expected == window);
+        EXPECT_LE(heap_matrix::allocations, 4 + 4);  // plus the table of odd powers
+    }
+}
+
+namespace {
+// gcd is idempotent: gcd(a, a) == a
+struct gcd_operation {
+    int* counter = nullptr;
+    std::uint64_t operator()(std::uint64_t a, std::uint64_t b) const {
+        ++*counter;
+        while (b != 0) {
+            a = std::exchange(b, a % b);
+        }
+        return a;
+    }
+};
+
+// addition modulo 2^61 - 1 with a user-provided native power
+struct plus_mod {
+    static constexpr std::uint64_t modulus = (std::uint64_t(1) << 61) - 1;
+    int* counter = nullptr;
+    std::uint64_t operator()(std::uint64_t a, std::uint64_t b) const {
+        ++*counter;
+        return (a + b) % modulus;
+    }
+};
+}  // namespace
+
+namespace clsc {
+template<> struct is_idempotent<gcd_operation> : std::true_type {};
+template<> struct native_power<plus_mod> {
+    static std::uint64_t apply(std::uint64_t a, std::uint64_t n, const plus_mod&) {
+        return std::uint64_t((unsigned __int128)a * (n % plus_mod::modulus) % plus_mod::modulus);
+    }
+};
+}  // namespace clsc
+
+static_assert(clsc::is_commutative_v<std::plus<double>>);
+static_assert(clsc::is_commutative_v<clsc::minimum<int>>);
+static_assert(!clsc::is_commutative_v<matrix_mod_multiplies>);
+static_assert(clsc::is_idempotent_v<std::bit_or<unsigned>>);
+static_assert(!clsc::is_idempotent_v<std::plus<int>>);
+static_assert(!clsc::detail::has_native_power_v<std::plus<float>, float, int>);
+static_assert(clsc::detail::has_native_power_v<std::plus<>, std::uint8_t, long>);
+static_assert(!clsc::detail::has_native_power_v<std::plus<std::string>, std::string, int>);
+static_assert(clsc::power_semigroup(7, 1000000, std::plus<int>{}) == 7000000);
+
+TEST(power_tests, native_power_of_addition) {
+    // 2^64 - 1 additions of 3 wrap around to -3
+    const std::uint64_t n = std::numeric_limits<std::uint64_t>::max();
+    EXPECT_EQ(std::uint64_t(0) - 3, clsc::power_semigroup(std::uint64_t(3), n, std::plus<>{}));
+    EXPECT_EQ(std::uint64_t(0) - 3,
+              clsc::power_semigroup(std::uint64_t(3), n, std::plus<std::uint64_t>{}));
+    EXPECT_EQ(-123456789 * 5, clsc::power_group(123456789, -5, std::plus<int>{}));
+    EXPECT_DOUBLE_EQ(0.1 * 1e9, clsc::power_monoid(0.1, 1000000000, std::plus<double>{}));
+    // small unsigned types wrap around instead of overflowing the promoted int
+    EXPECT_EQ(std::uint16_t(1),
+              clsc::power_semigroup(std::uint16_t(0xffff), 0xffff, std::plus<std::uint16_t>{}));
+    EXPECT_EQ(std::uint8_t(0xfe), clsc::power_semigroup(std::uint8_t(0xff), 2, std::plus<>{}));
+    // signed 64-bit sums wrap around in unsigned arithmetic instead of overflowing
+    const std::int64_t max64 = std::numeric_limits<std::int64_t>::max();
+    EXPECT_EQ(std::int64_t(-2), clsc::power_semigroup(max64, 2, std::plus<std::int64_t>{}));
+    EXPECT_EQ(max64 - 2, clsc::power_semigroup(max64, 3, std::plus<>{}));
+
+    int counter = 0;
+    const std::uint64_t a = 1234567890123ull;
+    EXPECT_EQ(std::uint64_t((unsigned __int128)a * n % plus_mod::modulus),
+              clsc::power_semigroup(a, n, plus_mod{&counter}));
+    EXPECT_EQ(0, counter);
+}
+
+TEST(power_tests, idempotent_operation_returns_early) {
+    int counter = 0;
+    EXPECT_EQ(42u, clsc::power_semigroup(std::uint64_t(42), 1000000007, gcd_operation{&counter}));
+    EXPECT_EQ(0, counter);
+    EXPECT_EQ(0x0fu, clsc::power_semigroup(0x0fu, 77, std::bit_and<unsigned>{}));
+    EXPECT_EQ(-3, clsc::power_monoid(-3, 1000, clsc::minimum<int>{}));
+    EXPECT_EQ(std::numeric_limits<int>::max(), clsc::power_monoid(-3, 0, clsc::minimum<int>{}));
+}
@@ -0,0 +1,120 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <algorithm.hpp>
+#include <batch_power.hpp>
+#include <montgomery.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace {
+template<typename T, typename Op>
+void batch_power_test_template(const std::vector<T>& bases, Op op) {
+    for (std::uint64_t n : {0ull, 1ull, 2ull, 7ull, 64ull, 1000ull, 0xfedcba9876543210ull}) {
+        // sizes around the vector block, including empty and partial tails
+        for (std::size_t size : {0, 1, 3, 16, 33, 100}) {
+            ASSERT_LE(size, bases.size());
+            std::vector<T> actual(size);
+            const auto end =
+                clsc::power_monoid_n(bases.begin(), bases.begin() + size, actual.begin(), n, op);
+            EXPECT_EQ(actual.end(), end);
+            for (std::size_t i = 0; i < size; ++i) {
+                EXPECT_EQ(clsc::power_monoid(bases[i], n, std::multiplies<T>{}), actual[i])
+                    << "n = " << n << ", i = " << i;
+            }
+        }
+    }
+}
+
+template<typename T> std::vector<T> random_bases(std::size_t size) {
+    std::mt19937_64 generator{};
+    std::vector<T> bases(size);
+    for (auto& x : bases) {
+        x = T(generator());
+    }
+    return bases;
+}
+}  // namespace
+
+TEST(batch_power_tests, unsigned_integers) {
+    batch_power_test_template(random_bases<std::uint32_t>(100), std::multiplies<std::uint32_t>{});
+    batch_power_test_template(random_bases<std::uint64_t>(100), std::multiplies<std::uint64_t>{});
+    batch_power_test_template(random_bases<std::uint8_t>(100), std::multiplies<>{});
+}
+
+TEST(batch_power_tests, floating_point) {
+    std::mt19937 generator{};
+    std::uniform_real_distribution<double> distribution(0.5, 1.5);
+    std::vector<double> doubles(100);
+    std::vector<float> floats(100);
+    for (std::size_t i = 0; i < doubles.size(); ++i) {
+        doubles[i] = distribution(generator);
+        floats[i] = float(doubles[i]);
+    }
+    // the vector kernel multiplies in the same order as power_semigroup, results are identical
+    batch_power_test_template(doubles, std::multiplies<double>{});
+    batch_power_test_template(floats, std::multiplies<float>{});
+}
+
+TEST(batch_power_tests, in_place) {
+    std::vector<std::uint32_t> values = random_bases<std::uint32_t>(50);
+    const std::vector<std::uint32_t> bases = values;
+    clsc::power_semigroup_n(values.data(), values.data() + values.size(), values.data(), 12345u,
+                            std::multiplies<std::uint32_t>{});
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(clsc::power_semigroup(bases[i], 12345u, std::multiplies<std::uint32_t>{}),
+                  values[i]);
+    }
+}
+
+TEST(batch_power_tests, generic_fallback) {
+    // non-contiguous ranges and non-arithmetic types go through power_semigroup element-wise
+    const clsc::montgomery_multiplies<std::uint64_t> op(1000000007);
+    const std::list<std::uint64_t> bases = {2, 3, 5, 7, 11};
+    std::vector<std::uint64_t> montgomery;
+    std::transform(bases.begin(), bases.end(), std::back_inserter(montgomery),
+                   [&](std::uint64_t x) { return op.to_montgomery(x); });
+    std::vector<std::uint64_t> actual;
+    clsc::power_monoid_n(montgomery.begin(), montgomery.end(), std::back_inserter(actual),
+                         1000000006ull, op);
+    ASSERT_EQ(bases.size(), actual.size());
+    for (std::uint64_t x : actual) {
+        EXPECT_EQ(1u, op.from_montgomery(x));  // Fermat's little theorem
+    }
+
+    std::list<std::uint64_t> sums;
+    clsc::power_monoid_n(bases.begin(), bases.end(), std::back_inserter(sums), 10,
+                         std::plus<std::uint64_t>{});
+    EXPECT_EQ((std::list<std::uint64_t>{20, 30, 50, 70, 110}), sums);
+}
@@ -0,0 +1,170 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <algorithm.hpp>
+#include <big_unsigned.hpp>
+#include <fibonacci.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+std::vector<std::uint32_t> random_limbs(std::size_t size, std::mt19937& generator) {
+    std::vector<std::uint32_t> limbs(size);
+    for (auto& limb : limbs) {
+        limb = generator();
+    }
+    limbs.back() |= 1u;
+    return limbs;
+}
+
+std::string begin_and_end(const std::string& s) {
+    return s.substr(0, 20) + "..." + s.substr(s.size() - 20);
+}
+}  // namespace
+
+TEST(big_unsigned_tests, small_values) {
+    EXPECT_EQ("0", clsc::big_unsigned().to_string());
+    EXPECT_EQ("0", clsc::big_unsigned(0).to_string());
+    EXPECT_EQ("4294967296", clsc::big_unsigned(4294967296ull).to_string());
+    EXPECT_EQ("18446744073709551615", clsc::big_unsigned(0xffffffffffffffffull).to_string());
+    EXPECT_EQ(2u, clsc::big_unsigned(0xffffffffffffffffull).limbs().size());
+    EXPECT_EQ(64u, clsc::big_unsigned(0xffffffffffffffffull).bit_length());
+    EXPECT_TRUE(clsc::big_unsigned().is_zero());
+
+    std::ostringstream stream;
+    stream << clsc::big_unsigned(100000000) << ' ' << clsc::big_unsigned(123456789012ull);
+    EXPECT_EQ("100000000 123456789012", stream.str());
+}
+
+TEST(big_unsigned_tests, addition_and_subtraction) {
+    const clsc::big_unsigned max64(0xffffffffffffffffull);
+    const clsc::big_unsigned sum = max64 + clsc::big_unsigned(1);
+    EXPECT_EQ("18446744073709551616", sum.to_string());
+    EXPECT_EQ(3u, sum.limbs().size());
+    EXPECT_EQ(max64, sum - clsc::big_unsigned(1));
+    EXPECT_EQ(clsc::big_unsigned(), sum - sum);
+    EXPECT_LT(max64, sum);
+    EXPECT_GT(sum, max64);
+    EXPECT_LE(sum, sum);
+}
+
+TEST(big_unsigned_tests, multiplication_methods) {
+    // sizes on both sides of the Karatsuba and transform thresholds, balanced and unbalanced
+    std::mt19937 generator{};
+    const std::size_t sizes[] = {1, 5, 31, 32, 33, 100, 1023, 1024, 1500, 4000};
+    for (std::size_t na : sizes) {
+        for (std::size_t nb : sizes) {
+            const std::vector<std::uint32_t> a = random_limbs(na, generator);
+            const std::vector<std::uint32_t> b = random_limbs(nb, generator);
+            std::vector<std::uint32_t> expected(na + nb);
+            clsc::detail::big_schoolbook<clsc::detail::big_binary_base>(a.data(), na, b.data(), nb,
+                                                                         expected.data());
+            const clsc::big_unsigned product = clsc::big_unsigned(a) * clsc::big_unsigned(b);
+            EXPECT_EQ(clsc::big_unsigned(expected), product) << na << " x " << nb;
+        }
+    }
+}
+
+TEST(big_unsigned_tests, multiplication_beyond_the_longest_transform) {
+    // 2^23-point transforms of both primes hold products of 2^22 limbs
+    EXPECT_EQ(std::size_t(1) << 22, clsc::detail::big_ntt_max_limbs);
+
+    // products on both sides of a lowered limit, the longer ones are split before the transform
+    std::mt19937 generator{};
+    const std::size_t limit = 4096;
+    const std::size_t sizes[][2] = {{2048, 2048}, {2048, 2049}, {3000, 1096}, {3000, 1097},
+                                    {2500, 2500}, {6000, 1024}};
+    for (const auto& size : sizes) {
+        const std::vector<std::uint32_t> a = random_limbs(size[0], generator);
+        const std::vector<std::uint32_t> b = random_limbs(size[1], generator);
+        std::vector<std::uint32_t> expected(a.size() + b.size());
+        clsc::detail::big_schoolbook<clsc::detail::big_binary_base>(a.data(), a.size(), b.data(),
+                                                                     b.size(), expected.data());
+        std::vector<std::uint32_t> product(a.size() + b.size());
+        clsc::detail::big_multiply<clsc::detail::big_binary_base>(
+            a.data(), a.size(), b.data(), b.size(), product.data(), limit);
+        EXPECT_EQ(expected, product) << size[0] << " x " << size[1];
+    }
+}
+
+TEST(big_unsigned_tests, squaring) {
+    std::mt19937 generator{};
+    for (std::size_t n : {10, 100, 2000}) {
+        const clsc::big_unsigned a(random_limbs(n, generator));
+        const clsc::big_unsigned copy = a;
+        EXPECT_EQ(a * copy, a * a);
+    }
+}
+
+TEST(big_unsigned_tests, powers_and_decimal_conversion) {
+    const clsc::big_unsigned three =
+        clsc::power_monoid(clsc::big_unsigned(3), 1000, std::multiplies<clsc::big_unsigned>{});
+    EXPECT_EQ("132207081948080663689045525975", three.to_string().substr(0, 30));
+    EXPECT_EQ(478u, three.to_string().size());
+
+    // long enough for several levels of divide-and-conquer conversion
+    for (std::size_t k : {1, 7, 8, 9, 1000, 50000}) {
+        const clsc::big_unsigned power =
+            clsc::power_monoid(clsc::big_unsigned(10), k, std::multiplies<clsc::big_unsigned>{});
+        EXPECT_EQ("1" + std::string(k, '0'), power.to_string()) << k;
+        EXPECT_EQ(std::string(k, '9'), (power - clsc::big_unsigned(1)).to_string()) << k;
+        std::ostringstream stream;
+        stream << power;
+        EXPECT_EQ(power.to_string(), stream.str());
+    }
+}
+
+TEST(big_unsigned_tests, fibonacci_big) {
+    for (std::uint64_t n = 0; n <= 93; ++n) {
+        EXPECT_EQ(clsc::big_unsigned(clsc::fibonacci(n)), clsc::fibonacci_big(n)) << n;
+    }
+    EXPECT_EQ("354224848179261915075", clsc::fibonacci_big(100).to_string());
+    EXPECT_EQ("43466557686937456435...76137795166849228875",
+              begin_and_end(clsc::fibonacci_big(1000).to_string()));
+    const std::string f100000 = clsc::fibonacci_big(100000).to_string();
+    EXPECT_EQ(20899u, f100000.size());
+    EXPECT_EQ("25974069347221724166...49895374653428746875", begin_and_end(f100000));
+    const std::string f1000000 = clsc::fibonacci_big(1000000).to_string();
+    EXPECT_EQ(208988u, f1000000.size());
+    EXPECT_EQ("19532821287077577316...68996526838242546875", begin_and_end(f1000000));
+}
+
+TEST(big_unsigned_tests, fibonacci_identities) {
+    // F(2n + 1) = F(n)^2 + F(n + 1)^2 and F(n + 2) = F(n + 1) + F(n)
+    const std::uint64_t n = 123457;
+    const clsc::big_unsigned f0 = clsc::fibonacci_big(n);
+    const clsc::big_unsigned f1 = clsc::fibonacci_big(n + 1);
+    EXPECT_EQ(f0 * f0 + f1 * f1, clsc::fibonacci_big(2 * n + 1));
+    EXPECT_EQ(f0 + f1, clsc::fibonacci_big(n + 2));
+}
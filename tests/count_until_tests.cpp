@@ -30,10 +30,59 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <stdexcept>
 #include <list>
+#include <random>
 #include <string>
 #include <vector>
 
+namespace {
+// compares count_until with a recognized predicate against std::find_if with the same predicate
+// hidden in a lambda, for every length and offset around the vector and block sizes
+template<typename T, typename Predicate>
+void expect_same_as_find_if(const std::vector<T>& values, Predicate p) {
+    const auto opaque = [p](const T& x) { return p(x); };
+    for (std::size_t offset = 0; offset < 8 && offset <= values.size(); ++offset) {
+        for (std::size_t n = 0; offset + n <= values.size() && n < 300; ++n) {
+            const auto first = values.cbegin() + offset;
+            const auto expected = std::find_if(first, first + n, opaque);
+            const auto actual = clsc::count_until(first, first + n, p);
+            EXPECT_EQ(expected, actual.first) << offset << " " << n;
+            EXPECT_EQ(expected - first, actual.second);
+            const auto actual_n = clsc::count_until_n(values.data() + offset, n, p);
+            EXPECT_EQ(expected - first, actual_n.second);
+            EXPECT_EQ(values.data() + offset + actual_n.second, actual_n.first);
+        }
+    }
+}
+
+template<typename T> void expect_vectorized_predicates() {
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> digit(0, 99);
+    std::vector<T> values(320);
+    for (auto& value : values) {
+        value = T(digit(generator));
+    }
+    // hits only in a few places so that the scans cross many vectors first
+    std::vector<T> sparse(values.size(), T(50));
+    for (std::size_t i : {37u, 161u, 300u}) {
+        sparse[i] = T(i % 2 == 0 ? 3 : 97);
+    }
+    for (const auto* data : {&values, &sparse}) {
+        expect_same_as_find_if(*data, clsc::equal_to_value<T>(T(3)));
+        expect_same_as_find_if(*data, clsc::equal_to_value<T>(T(97)));
+        expect_same_as_find_if(*data, clsc::less_than<T>(T(5)));
+        expect_same_as_find_if(*data, clsc::greater_than<T>(T(90)));
+        expect_same_as_find_if(*data, clsc::in_range<T>(T(95), T(97)));
+        expect_same_as_find_if(*data, clsc::in_range<T>(T(40), T(60)));
+    }
+}
+}  // namespace
+
 TEST(count_until_tests, empty_collection) {
     const std::vector<int> collection{};
     const auto always_false = [](int) { return false; };
@@ -110,3 +159,262 @@ TEST(count_until_tests, date_time) {
         EXPECT_EQ(5, counted);
     }
 }
+
+TEST(count_until_tests, vectorized_predicates) {
+    expect_vectorized_predicates<char>();
+    expect_vectorized_predicates<signed char>();
+    expect_vectorized_predicates<std::uint8_t>();
+    expect_vectorized_predicates<std::int16_t>();
+    expect_vectorized_predicates<std::uint16_t>();
+    expect_vectorized_predicates<int>();
+    expect_vectorized_predicates<std::uint32_t>();
+    expect_vectorized_predicates<std::int64_t>();
+    expect_vectorized_predicates<std::uint64_t>();
+    expect_vectorized_predicates<float>();
+    expect_vectorized_predicates<double>();
+}
+
+TEST(count_until_tests, vectorized_extremes) {
+    // unsigned and signed orderings at the ends of the value range
+    std::vector<std::uint32_t> unsigned_values(200, 0x7fffffffu);
+    unsigned_values[150] = 0x80000000u;
+    expect_same_as_find_if(unsigned_values, clsc::greater_than<std::uint32_t>(0x7fffffffu));
+    std::vector<std::int8_t> signed_values(200, 0);
+    signed_values[99] = -128;
+    expect_same_as_find_if(signed_values, clsc::less_than<std::int8_t>(-127));
+
+    // NaN satisfies none of the predicates
+    std::vector<double> doubles(200, std::numeric_limits<double>::quiet_NaN());
+    doubles[120] = 1.0;
+    expect_same_as_find_if(doubles, clsc::less_than<double>(2.0));
+    expect_same_as_find_if(doubles, clsc::in_range<double>(-1.0, 1.0));
+    EXPECT_EQ(120, clsc::count_until(doubles.begin(), doubles.end(),
+                                     clsc::equal_to_value<double>(1.0))
+                       .second);
+}
+
+TEST(count_until_tests, recognized_predicates_on_other_ranges) {
+    // non-contiguous ranges and mismatched element types go through the generic loop
+    const std::list<int> list{5, 4, 3, 2, 1};
+    EXPECT_EQ(2, clsc::count_until(list.begin(), list.end(), clsc::equal_to_value<int>(3)).second);
+    const std::string text = "key=value";
+    EXPECT_EQ(3,
+              clsc::count_until(text.begin(), text.end(), clsc::equal_to_value<int>('=')).second);
+    EXPECT_EQ(3,
+              clsc::count_until(text.begin(), text.end(), clsc::equal_to_value<char>('=')).second);
+    const std::vector<long double> wide{1.0L, 2.0L, 3.0L};
+    EXPECT_EQ(1, clsc::count_until(wide.begin(), wide.end(), clsc::greater_than<long double>(1.5L))
+                     .second);
+}
+
+#if defined(CLSC_VECTOR_EXTENSIONS)
+TEST(count_until_tests, vector_kernels) {
+    // both kernels regardless of which one the processor selects
+    std::vector<std::uint16_t> values(1000, 7);
+    const auto p = clsc::greater_than<std::uint16_t>(8);
+    for (std::size_t hit : {0u, 5u, 31u, 64u, 200u, 997u}) {
+        values[hit] = 9;
+        for (std::size_t n = 0; n <= hit + 40 && n <= values.size(); ++n) {
+            const std::size_t expected = std::min(hit, n);
+            EXPECT_EQ(expected, clsc::detail::count_until_default(values.data(), n, p));
+#if defined(CLSC_X86_SIMD) && !defined(__AVX2__)
+            if (clsc::detail::cpu_has_avx2()) {
+                EXPECT_EQ(expected, clsc::detail::count_until_avx2(values.data(), n, p));
+            }
+#endif
+        }
+        values[hit] = 7;
+    }
+}
+#endif
+
+TEST(count_until_tests, parallel_matches_sequential) {
+    const std::size_t size = 600001;
+    std::vector<std::int32_t> values(size, 1);
+    // first matches in the first, a middle and the last chunk, in chunk corners, and none at all
+    for (std::size_t hit : {std::size_t(0), std::size_t(65535), std::size_t(65536),
+                            std::size_t(300000), size - 1, size}) {
+        if (hit < size) {
+            values[hit] = -1;
+            // later matches must not win over the first one
+            for (std::size_t later = hit + 1; later < size; later += 70001) {
+                values[later] = -2;
+            }
+        }
+        const auto expected = clsc::count_until(values.begin(), values.end(),
+                                                clsc::less_than<std::int32_t>(0));
+        for (std::size_t threads : {1, 2, 3, 8}) {
+            const auto actual = clsc::count_until(values.begin(), values.end(),
+                                                  clsc::less_than<std::int32_t>(0), threads);
+            EXPECT_EQ(expected, actual) << hit << " " << threads;
+            const auto opaque = clsc::count_until(
+                values.cbegin(), values.cend(), [](std::int32_t x) { return x < 0; }, threads);
+            EXPECT_EQ(expected.second, opaque.second);
+            const auto actual_n =
+                clsc::count_until_n(values.data(), size, clsc::less_than<std::int32_t>(0), threads);
+            EXPECT_EQ(std::ptrdiff_t(std::min(hit, size)), actual_n.second);
+            EXPECT_EQ(values.data() + actual_n.second, actual_n.first);
+        }
+        std::fill(values.begin(), values.end(), 1);
+    }
+}
+
+TEST(count_until_tests, parallel_other_ranges) {
+    std::deque<int> values(100000, 0);
+    values[77777] = 1;
+    const auto actual =
+        clsc::count_until(values.begin(), values.end(), [](int x) { return x != 0; }, 4);
+    EXPECT_EQ(77777, actual.second);
+    EXPECT_EQ(values.begin() + 77777, actual.first);
+
+    const std::vector<int> empty;
+    EXPECT_EQ(0, clsc::count_until(empty.begin(), empty.end(), [](int) { return true; }, 4).second);
+    EXPECT_EQ(0, clsc::count_until_n(empty.begin(), 0, [](int) { return true; }, 4).second);
+
+    EXPECT_THROW(clsc::count_until(
+                     values.begin(), values.end(),
+                     [](int x) -> bool { throw std::runtime_error(std::to_string(x)); }, 4),
+                 std::runtime_error);
+}
+
+TEST(count_until_tests, deque_segments) {
+    // front insertions make the first block partial, so the ranges cross blocks at odd offsets
+    std::deque<std::int16_t> values;
+    for (int i = 0; i < 3000; ++i) {
+        values.push_back(std::int16_t(i % 1000));
+        values.push_front(std::int16_t(i % 1000));
+    }
+    const auto opaque = [](std::int16_t x) { return x == 999; };
+    for (std::size_t from : {0, 1, 255, 256, 257, 1000}) {
+        for (std::size_t count : {0, 1, 200, 256, 1000, 3000}) {
+            const auto first = values.cbegin() + std::ptrdiff_t(from);
+            const auto last = first + std::ptrdiff_t(count);
+            const auto expected = std::find_if(first, last, opaque);
+            const auto actual =
+                clsc::count_until(first, last, clsc::equal_to_value<std::int16_t>(999));
+            EXPECT_EQ(expected, actual.first) << from << " " << count;
+            EXPECT_EQ(expected - first, actual.second);
+            EXPECT_EQ(actual, clsc::count_until(first, last, opaque));
+            EXPECT_EQ(actual, clsc::count_until_n(first, count, opaque));
+        }
+    }
+
+    std::deque<int> mutable_values(1000, 0);
+    mutable_values[700] = 1;
+    const auto found = clsc::count_until(mutable_values.begin(), mutable_values.end(),
+                                         clsc::greater_than<int>(0));
+    EXPECT_EQ(700, found.second);
+    EXPECT_EQ(mutable_values.begin() + 700, found.first);
+}
+
+TEST(count_until_tests, unreachable_sentinel) {
+    std::vector<int> values(100, 0);
+    for (std::size_t hit = 0; hit < values.size(); ++hit) {
+        values[hit] = 1;
+        const auto opaque = [](int x) { return x != 0; };
+        const auto actual = clsc::count_until(values.begin(), clsc::unreachable_sentinel, opaque);
+        EXPECT_EQ(std::ptrdiff_t(hit), actual.second);
+        EXPECT_EQ(values.begin() + std::ptrdiff_t(hit), actual.first);
+        EXPECT_EQ(std::ptrdiff_t(hit),
+                  clsc::count_until(values.data(), clsc::unreachable_sentinel,
+                                    clsc::greater_than<int>(0))
+                      .second);
+        values[hit] = 0;
+    }
+
+    const std::list<char> list{'a', 'b', 'c', '\0'};
+    const auto found =
+        clsc::count_until(list.begin(), clsc::unreachable_sentinel, [](char c) { return c == 0; });
+    EXPECT_EQ(3, found.second);
+    EXPECT_EQ(std::prev(list.end()), found.first);
+}
+
+TEST(count_until_tests, predicate_sentinel) {
+    const char* text = "key=value;next";
+    const auto is_end = [](char c) { return c == '\0' || c == ';'; };
+    const clsc::predicate_sentinel<decltype(is_end)> end(is_end);
+    const auto key = clsc::count_until(text, end, clsc::equal_to_value<char>('='));
+    EXPECT_EQ(3, key.second);
+    EXPECT_EQ(text + 3, key.first);
+    const auto rest = clsc::count_until(key.first + 1, end, clsc::equal_to_value<char>('='));
+    EXPECT_EQ(5, rest.second);
+    EXPECT_EQ(';', *rest.first);
+    EXPECT_EQ(0, clsc::count_until(text + 9, end, [](char) { return true; }).second);
+}
+
+static_assert(clsc::detail::is_contiguous_iterator_v<std::string::iterator>);
+static_assert(clsc::detail::is_contiguous_iterator_v<std::u32string::const_iterator>);
+static_assert(!clsc::detail::is_contiguous_iterator_v<std::string::reverse_iterator>);
+
+TEST(count_until_tests, guarded) {
+    std::mt19937 generator{};
+    for (std::size_t size : {0, 1, 2, 3, 4, 5, 8, 100, 1001}) {
+        std::vector<int> values(size);
+        for (auto& value : values) {
+            value = int(generator() % 50);
+        }
+        const std::vector<int> original = values;
+        const auto opaque = [](int x) { return x == 7; };
+        const auto expected = clsc::count_until(values.begin(), values.end(), opaque);
+        const auto actual = clsc::count_until_guarded(values.begin(), values.end(), opaque, 7);
+        EXPECT_EQ(expected, actual) << size;
+        EXPECT_EQ(original, values);
+
+        // recognized predicates take their guard from the predicate; reverse iterators are not
+        // contiguous, so they go through the guarded scan rather than vector kernels
+        std::string text(values.begin(), values.end());
+        for (char threshold : {0, 3, 49}) {
+            const auto expected_text =
+                clsc::count_until(text.rbegin(), text.rend(), clsc::less_than<char>(threshold));
+            EXPECT_EQ(expected_text, clsc::count_until_guarded(text.rbegin(), text.rend(),
+                                                               clsc::less_than<char>(threshold)));
+        }
+        EXPECT_EQ(clsc::count_until(text.rbegin(), text.rend(), clsc::in_range<char>(5, 9)),
+                  clsc::count_until_guarded(text.rbegin(), text.rend(),
+                                            clsc::in_range<char>(5, 9)));
+        EXPECT_EQ(clsc::count_until(text.rbegin(), text.rend(), clsc::greater_than<char>(45)),
+                  clsc::count_until_guarded(text.rbegin(), text.rend(),
+                                            clsc::greater_than<char>(45)));
+        EXPECT_TRUE(std::equal(text.begin(), text.end(), original.begin(), original.end()));
+        // string iterators are contiguous and take the vector kernels
+        EXPECT_EQ(clsc::count_until(text.data(), text.data() + text.size(),
+                                    clsc::greater_than<char>(45))
+                      .second,
+                  clsc::count_until_guarded(text.begin(), text.end(),
+                                            clsc::greater_than<char>(45))
+                      .second);
+
+        std::deque<int> deque(values.begin(), values.end());
+        EXPECT_EQ(clsc::count_until(deque.begin(), deque.end(), opaque),
+                  clsc::count_until_guarded(deque.begin(), deque.end(), opaque, 7));
+    }
+
+    // the only match is the guarded element itself, or there is no match at all
+    std::vector<unsigned> values{1, 2, 3, 0};
+    EXPECT_EQ(3, clsc::count_until_guarded(values.begin(), values.end(),
+                                           [](unsigned x) { return x == 0; }, 0u)
+                     .second);
+    values.back() = 4;
+    const auto none = clsc::count_until_guarded(values.begin(), values.end(),
+                                                [](unsigned x) { return x == 0; }, 0u);
+    EXPECT_EQ(values.end(), none.first);
+    EXPECT_EQ(4, none.second);
+    EXPECT_EQ(4u, values.back());
+    // less_than<unsigned>(0) holds for no value, there is nothing to plant
+    EXPECT_EQ(4, clsc::count_until_guarded(values.begin(), values.end(),
+                                           clsc::less_than<unsigned>(0))
+                     .second);
+}
+
+TEST(count_until_tests, guarded_restores_on_exception) {
+    std::vector<std::string> values{"a", "b", "c", "last"};
+    const auto throwing = [](const std::string& x) -> bool {
+        if (x == "c") {
+            throw std::runtime_error(x);
+        }
+        return x == "guard";
+    };
+    EXPECT_THROW(clsc::count_until_guarded(values.begin(), values.end(), throwing, "guard"),
+                 std::runtime_error);
+    EXPECT_EQ("last", values.back());
+}
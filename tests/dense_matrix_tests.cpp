@@ -0,0 +1,117 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm.hpp>
+#include <dense_matrix.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+
+namespace {
+template<typename T>
+clsc::dense_matrix<T> random_dense_matrix(std::size_t rows, std::size_t cols,
+                                          std::mt19937& generator) {
+    clsc::dense_matrix<T> m(rows, cols);
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            m(i, j) = T(generator() % 5);
+        }
+    }
+    return m;
+}
+
+template<typename T>
+clsc::dense_matrix<T> naive_multiply(const clsc::dense_matrix<T>& a,
+                                     const clsc::dense_matrix<T>& b) {
+    clsc::dense_matrix<T> c(a.rows(), b.cols());
+    for (std::size_t i = 0; i < a.rows(); ++i) {
+        for (std::size_t j = 0; j < b.cols(); ++j) {
+            for (std::size_t k = 0; k < a.cols(); ++k) {
+                c(i, j) += a(i, k) * b(k, j);
+            }
+        }
+    }
+    return c;
+}
+
+template<typename T> void dense_multiply_test_template() {
+    std::mt19937 generator{};
+    // shapes around the register tile and the cache blocks
+    const std::size_t shapes[][3] = {{1, 1, 1},      {3, 5, 7},      {4, 8, 16}, {17, 33, 9},
+                                     {130, 300, 70}, {5, 300, 2100}, {70, 0, 3}};
+    for (const auto& shape : shapes) {
+        const auto a = random_dense_matrix<T>(shape[0], shape[1], generator);
+        const auto b = random_dense_matrix<T>(shape[1], shape[2], generator);
+        const auto expected = naive_multiply(a, b);
+        for (std::size_t threads : {1, 2, 3}) {
+            const clsc::dense_matrix_multiplies<T> op(0, threads);
+            EXPECT_TRUE(expected == op(a, b))
+                << shape[0] << "x" << shape[1] << "x" << shape[2] << ", " << threads << " threads";
+        }
+        EXPECT_TRUE(expected == a * b);
+    }
+}
+}  // namespace
+
+TEST(dense_matrix_tests, multiply) {
+    dense_multiply_test_template<double>();
+    dense_multiply_test_template<float>();
+    dense_multiply_test_template<std::int32_t>();
+    dense_multiply_test_template<std::uint64_t>();
+}
+
+TEST(dense_matrix_tests, output_parameter_reuses_storage) {
+    std::mt19937 generator{};
+    const auto a = random_dense_matrix<double>(40, 40, generator);
+    const auto b = random_dense_matrix<double>(40, 40, generator);
+    clsc::dense_matrix<double> c(40, 40);
+    const double* storage = c.data();
+    const clsc::dense_matrix_multiplies<double> op;
+    op(c, a, b);
+    EXPECT_EQ(storage, c.data());
+    EXPECT_TRUE(naive_multiply(a, b) == c);
+    EXPECT_TRUE((clsc::detail::has_output_operation_v<clsc::dense_matrix_multiplies<double>,
+                                                      clsc::dense_matrix<double>>));
+}
+
+TEST(dense_matrix_tests, power) {
+    std::mt19937 generator{};
+    const std::size_t n = 37;
+    const auto a = random_dense_matrix<std::uint64_t>(n, n, generator);
+    auto expected = clsc::dense_matrix<std::uint64_t>::identity(n);
+    for (int e = 1; e <= 21; ++e) {
+        expected = naive_multiply(expected, a);
+        const clsc::dense_matrix_multiplies<std::uint64_t> op(n, 2);
+        EXPECT_TRUE(expected == clsc::power_semigroup(a, e, op)) << e;
+        EXPECT_TRUE(expected == clsc::power_monoid(a, e, op)) << e;
+    }
+    const clsc::dense_matrix_multiplies<std::uint64_t> op(n);
+    EXPECT_TRUE(clsc::dense_matrix<std::uint64_t>::identity(n) == clsc::power_monoid(a, 0, op));
+}
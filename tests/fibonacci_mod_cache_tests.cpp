@@ -0,0 +1,166 @@
+// Copyright 2021 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <fibonacci.hpp>
+#include <fibonacci_mod_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+// smallest k > 0 with F(k) = 0 and F(k + 1) = 1 (mod m)
+std::uint64_t brute_force_period(std::uint64_t m) {
+    std::uint64_t a = 0;
+    std::uint64_t b = 1 % m;
+    for (std::uint64_t k = 1;; ++k) {
+        const std::uint64_t next = (a + b) % m;
+        a = b;
+        b = next;
+        if (a == 0 && b == 1 % m) {
+            return k;
+        }
+    }
+}
+}  // namespace
+
+TEST(fibonacci_mod_cache_tests, factorize) {
+    std::mt19937_64 generator{};
+    std::vector<std::uint64_t> ns = {1, 2, 97, 4294967291ull * 4294967279ull,
+                                     999999937ull * 999999937ull, 0xffffffffffffffffull,
+                                     0xffffffffffffffc5ull};
+    for (int i = 0; i < 100; ++i) {
+        ns.push_back(generator() | 1u);
+    }
+    for (std::uint64_t n : ns) {
+        std::uint64_t product = 1;
+        std::uint64_t previous = 1;
+        for (const auto& factor : clsc::detail::factorize(n)) {
+            EXPECT_TRUE(clsc::detail::is_prime_u64(factor.first)) << factor.first;
+            EXPECT_LT(previous, factor.first);
+            previous = factor.first;
+            for (int i = 0; i < factor.second; ++i) {
+                product *= factor.first;
+            }
+        }
+        EXPECT_EQ(n, product);
+    }
+    EXPECT_FALSE(clsc::detail::is_prime_u64(3215031751ull));  // strong pseudoprime to 2, 3, 5, 7
+    EXPECT_TRUE(clsc::detail::is_prime_u64(0xffffffffffffffc5ull));
+}
+
+TEST(fibonacci_mod_cache_tests, pisano_period) {
+    for (std::uint64_t m = 1; m <= 2000; ++m) {
+        EXPECT_EQ(brute_force_period(m), clsc::pisano_period(m)) << m;
+    }
+    EXPECT_EQ(2000000016u, clsc::pisano_period(1000000007));
+    EXPECT_EQ(1500000000u, clsc::pisano_period(1000000000));
+
+    std::mt19937_64 generator{};
+    for (int i = 0; i < 100; ++i) {
+        const std::uint64_t m = generator() >> (i % 40);
+        const std::uint64_t period = clsc::pisano_period(m);
+        if (period != 0) {
+            EXPECT_EQ(0u, clsc::fibonacci_mod(period, m)) << m;
+            EXPECT_EQ(1 % m, clsc::fibonacci_mod(period + 1, m)) << m;
+        }
+    }
+}
+
+TEST(fibonacci_mod_cache_tests, queries) {
+    clsc::fibonacci_mod_cache cache;
+    std::mt19937_64 generator{};
+    for (std::uint64_t m : {1ull, 10ull, 1000ull, 65536ull, 1000000007ull, 0xffffffffffffffc5ull}) {
+        for (int i = 0; i < 200; ++i) {
+            const std::uint64_t n = generator();
+            EXPECT_EQ(clsc::fibonacci_mod(n, m), cache(n, m)) << n << " mod " << m;
+        }
+    }
+    EXPECT_TRUE(cache.tabulated(1000));
+    EXPECT_FALSE(cache.tabulated(1000000007));  // 8 GB for one period
+    EXPECT_EQ(60u, cache.period(10));
+    EXPECT_EQ(6u, cache.size());
+}
+
+TEST(fibonacci_mod_cache_tests, eviction) {
+    // every modulus has a period of 1500, the budget has room for two tables
+    clsc::fibonacci_mod_cache cache(15000);
+    const std::uint64_t moduli[] = {250, 500, 1000};
+    for (std::uint64_t m : moduli) {
+        EXPECT_EQ(1500u, cache.period(m));
+        EXPECT_EQ(clsc::fibonacci_mod(12345, m), cache(12345, m));
+        EXPECT_LE(cache.memory_usage(), cache.budget());
+        EXPECT_TRUE(cache.tabulated(m));
+    }
+    EXPECT_EQ(2u, cache.size());
+    EXPECT_FALSE(cache.tabulated(250));
+    EXPECT_TRUE(cache.tabulated(500));
+
+    // the least recently used modulus goes first
+    cache(1, 500);
+    cache(1, 250);
+    EXPECT_TRUE(cache.tabulated(500));
+    EXPECT_FALSE(cache.tabulated(1000));
+}
+
+TEST(fibonacci_mod_cache_tests, hit_after_insertion_outranks_it) {
+    // every modulus has a period of 1500, the budget has room for two tables
+    clsc::fibonacci_mod_cache cache(15000);
+    cache(1, 250);
+    cache(1, 500);
+    cache(1, 250);  // used after 500 was inserted
+    cache(1, 1000);
+    EXPECT_TRUE(cache.tabulated(250));
+    EXPECT_FALSE(cache.tabulated(500));
+    EXPECT_TRUE(cache.tabulated(1000));
+}
+
+TEST(fibonacci_mod_cache_tests, concurrent_readers) {
+    clsc::fibonacci_mod_cache cache(1 << 16);
+    std::vector<std::thread> threads;
+    std::vector<int> mismatches(4, 0);
+    for (std::size_t t = 0; t < mismatches.size(); ++t) {
+        threads.emplace_back([&cache, &mismatches, t]() {
+            std::mt19937_64 generator(t);
+            for (int i = 0; i < 2000; ++i) {
+                const std::uint64_t m = 2 + generator() % 200;
+                const std::uint64_t n = generator();
+                mismatches[t] += cache(n, m) != clsc::fibonacci_mod(n, m);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (int count : mismatches) {
+        EXPECT_EQ(0, count);
+    }
+    EXPECT_LE(cache.memory_usage(), cache.budget());
+}
@@ -27,10 +27,17 @@
 // IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <fibonacci.hpp>
+#include <linear_recurrence.hpp>
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <list>
 #include <numeric>
+#include <random>
+#include <vector>
 
 TEST(fibonacci_tests, zero) {
     const std::uint64_t expected = 0;
@@ -71,3 +78,148 @@ TEST(fibonacci_tests, random_inputs) {
         EXPECT_EQ(expected, clsc::fibonacci(n));
     }
 }
+
+TEST(fibonacci_tests, constant_expression) {
+    static_assert(clsc::fibonacci(10) == 55);
+    static_assert(clsc::fibonacci(93) == 12200160415121876738ull);
+}
+
+TEST(fibonacci_tests, doubling_matches_matrix) {
+    // values beyond F(93) wrap around 2^64 in both implementations
+    for (std::uint32_t n = 0; n < 1000; ++n) {
+        EXPECT_EQ(clsc::fibonacci_matrix(n), clsc::fibonacci(n)) << n;
+    }
+    EXPECT_EQ(clsc::fibonacci_matrix(0xffffffffu), clsc::fibonacci(0xffffffffu));
+}
+
+TEST(fibonacci_tests, modulo) {
+    for (std::uint64_t n = 0; n <= 93; ++n) {
+        for (std::uint64_t m : {1ull, 2ull, 10ull, 1000000007ull, 0xffffffffffffffffull}) {
+            EXPECT_EQ(clsc::fibonacci(n) % m, clsc::fibonacci_mod(n, m)) << n << " mod " << m;
+        }
+    }
+    // Pisano periods
+    EXPECT_EQ(0u, clsc::fibonacci_mod(60, 10));
+    EXPECT_EQ(1u, clsc::fibonacci_mod(61, 10));
+    EXPECT_EQ(0u, clsc::fibonacci_mod(2000000016ull * 123456789ull, 1000000007));
+}
+
+TEST(fibonacci_tests, modulo_large_indices) {
+    std::mt19937_64 generator{};
+    // odd moduli take the Montgomery path, even ones the 128-bit division path
+    for (std::uint64_t m : {3ull, 998244353ull, 1000000000000000000ull, 0xffffffffffffffc5ull,
+                            0xfffffffffffffffeull}) {
+        const clsc::linear_recurrence<std::uint64_t> reference({1, 1}, {0, 1}, m);
+        for (int i = 0; i < 50; ++i) {
+            const std::uint64_t n = generator();
+            EXPECT_EQ(reference(n), clsc::fibonacci_mod(n, m)) << n << " mod " << m;
+        }
+    }
+}
+
+TEST(fibonacci_tests, modulo_constant_expression) {
+    static_assert(clsc::fibonacci_mod(93, 1000) == 738);
+    static_assert(clsc::fibonacci_mod(100, 1000000007) == 687995182);
+    static_assert(clsc::fibonacci_mod(100, 1000000008) == 463152315);
+    static_assert(clsc::fibonacci_mod(100, 0xffffffffffffffffull) == 3736710778780434390ull);
+}
+
+TEST(fibonacci_tests, batch) {
+    std::mt19937 generator{};
+    std::vector<std::uint32_t> ns;
+    // table values, every bit length and partial groups of lanes
+    for (std::uint32_t n = 0; n < 200; ++n) {
+        ns.push_back(n);
+    }
+    for (int bits = 7; bits <= 32; ++bits) {
+        for (int i = 0; i < bits; ++i) {
+            ns.push_back(std::uint32_t(generator() >> (32 - bits)) | (1u << (bits - 1)));
+        }
+    }
+    ns.push_back(0xffffffffu);
+    std::shuffle(ns.begin(), ns.end(), generator);
+
+    std::vector<std::uint64_t> actual(ns.size());
+    EXPECT_EQ(actual.end(), clsc::fibonacci_batch(ns.begin(), ns.end(), actual.begin()));
+    for (std::size_t i = 0; i < ns.size(); ++i) {
+        EXPECT_EQ(clsc::fibonacci(ns[i]), actual[i]) << ns[i];
+    }
+}
+
+TEST(fibonacci_tests, batch_iterators) {
+    const std::list<long long> ns = {5, 100, 10000000000ll, 1, 93, 94};
+    std::vector<std::uint64_t> actual;
+    clsc::fibonacci_batch(ns.begin(), ns.end(), std::back_inserter(actual));
+    ASSERT_EQ(ns.size(), actual.size());
+    auto n = ns.begin();
+    for (std::size_t i = 0; i < actual.size(); ++i, ++n) {
+        EXPECT_EQ(clsc::fibonacci(std::uint64_t(*n)), actual[i]);
+    }
+
+    std::uint64_t out[1] = {42};
+    const std::uint32_t* none = nullptr;
+    EXPECT_EQ(out, clsc::fibonacci_batch(none, none, out));
+    EXPECT_EQ(42u, out[0]);
+}
+
+TEST(fibonacci_tests, fill) {
+    // every tail length around the vector stride, at small and wrapping starting indices
+    for (std::uint64_t a : {0ull, 1ull, 7ull, 90ull, 1000ull, 123456789012ull}) {
+        for (std::size_t count = 0; count < 70; ++count) {
+            std::vector<std::uint64_t> actual(count + 1, 42);
+            EXPECT_EQ(actual.begin() + count, clsc::fibonacci_fill(actual.begin(), a, count));
+            for (std::size_t i = 0; i < count; ++i) {
+                EXPECT_EQ(clsc::fibonacci(a + i), actual[i]) << a << " + " << i;
+            }
+            EXPECT_EQ(42u, actual[count]);
+        }
+    }
+
+    std::vector<std::uint64_t> large(100003);
+    clsc::fibonacci_fill(large.data(), 5000, large.size());
+    for (std::size_t i = 0; i < large.size(); i += 997) {
+        EXPECT_EQ(clsc::fibonacci(5000 + i), large[i]);
+    }
+    EXPECT_EQ(clsc::fibonacci(5000 + large.size() - 1), large.back());
+}
+
+TEST(fibonacci_tests, fill_iterators) {
+    std::list<std::uint64_t> list;
+    clsc::fibonacci_fill(std::back_inserter(list), 10, 50);
+    ASSERT_EQ(50u, list.size());
+    std::uint64_t n = 10;
+    for (std::uint64_t value : list) {
+        EXPECT_EQ(clsc::fibonacci(n++), value);
+    }
+
+    // narrower output type takes the scalar path
+    std::vector<std::uint32_t> narrow(40);
+    clsc::fibonacci_fill(narrow.begin(), 3, narrow.size());
+    for (std::size_t i = 0; i < narrow.size(); ++i) {
+        EXPECT_EQ(std::uint32_t(clsc::fibonacci(3 + i)), narrow[i]);
+    }
+}
+
+TEST(fibonacci_tests, range) {
+    std::vector<std::uint64_t> actual;
+    for (std::uint64_t value : clsc::fibonacci_range(100, 130)) {
+        actual.push_back(value);
+    }
+    ASSERT_EQ(31u, actual.size());
+    for (std::size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(clsc::fibonacci(100 + i), actual[i]);
+    }
+
+    const auto range = clsc::fibonacci_range(0, 10);
+    EXPECT_EQ(11u, range.size());
+    EXPECT_EQ(clsc::fibonacci(12) - 1, std::accumulate(range.begin(), range.end(), 0ull));
+    EXPECT_EQ(10u, std::next(range.begin(), 10).index());
+
+    const auto single = clsc::fibonacci_range(93, 93);
+    ASSERT_EQ(1u, single.size());
+    EXPECT_EQ(clsc::fibonacci(93), *single.begin());
+
+    const auto none = clsc::fibonacci_range(5, 4);
+    EXPECT_TRUE(none.empty());
+    EXPECT_EQ(none.begin(), none.end());
+}
@@ -0,0 +1,104 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm.hpp>
+#include <fixed_base_power.hpp>
+
+#include <gtest/gtest.h>
+
+#include <bitset>
+#include <cstdint>
+#include <functional>
+#include <random>
+
+namespace {
+struct counting_multiplies {
+    int* counter = nullptr;
+    std::uint64_t operator()(std::uint64_t a, std::uint64_t b) const {
+        ++*counter;
+        return a * b;
+    }
+};
+std::uint64_t identity_element(counting_multiplies) { return 1; }
+}  // namespace
+
+TEST(fixed_base_power_tests, matches_power_monoid) {
+    std::mt19937_64 generator{};
+    for (std::size_t window : {1, 2, 4, 5, 8}) {
+        const std::uint64_t base = 0x9e3779b97f4a7c15ull;
+        const clsc::fixed_base_power<std::uint64_t, std::multiplies<std::uint64_t>> power(
+            base, std::multiplies<std::uint64_t>{}, 64, window);
+        for (int i = 0; i < 200; ++i) {
+            const std::uint64_t n = generator() >> (i % 64);
+            EXPECT_EQ(clsc::power_monoid(base, n, std::multiplies<std::uint64_t>{}), power(n));
+        }
+        EXPECT_EQ(1u, power(0));
+        EXPECT_EQ(base, power(1));
+    }
+}
+
+TEST(fixed_base_power_tests, additive_monoid) {
+    const clsc::fixed_base_power<int, std::plus<int>> power(7, std::plus<int>{}, 16, 3);
+    for (int n = 0; n < (1 << 16); n += 37) {
+        EXPECT_EQ(7 * n, power(n));
+    }
+}
+
+TEST(fixed_base_power_tests, no_squarings_per_query) {
+    int counter = 0;
+    const clsc::fixed_base_power<std::uint64_t, counting_multiplies> power(
+        3, counting_multiplies{&counter}, 32);
+    for (std::uint32_t n : {1u, 2u, 5u, 255u, 1024u, 0xdeadbeefu, 0xffffffffu}) {
+        counter = 0;
+        const std::uint64_t actual = power(n);
+        EXPECT_EQ(std::bitset<32>(n).count() - 1, std::size_t(counter));
+        EXPECT_EQ(clsc::power_monoid(std::uint64_t(3), n, std::multiplies<std::uint64_t>{}),
+                  actual);
+    }
+}
+
+TEST(fixed_base_power_tests, exponents_beyond_the_table) {
+    std::mt19937_64 generator{};
+    const std::uint64_t base = 0x9e3779b97f4a7c15ull;
+    for (std::size_t window : {1, 3, 4}) {
+        for (std::size_t bits : {1, 7, 12, 32}) {
+            const clsc::fixed_base_power<std::uint64_t, std::multiplies<std::uint64_t>> power(
+                base, std::multiplies<std::uint64_t>{}, bits, window);
+            for (int i = 0; i < 100; ++i) {
+                const std::uint64_t n = generator() >> (i % 64);
+                EXPECT_EQ(clsc::power_monoid(base, n, std::multiplies<std::uint64_t>{}), power(n))
+                    << n << " " << bits << " " << window;
+            }
+            // only high bits, and the single bit just past the table
+            const std::uint64_t top = std::uint64_t(1) << power.max_exponent_bits();
+            EXPECT_EQ(clsc::power_monoid(base, top, std::multiplies<std::uint64_t>{}), power(top));
+            EXPECT_EQ(clsc::power_monoid(base, top + 1, std::multiplies<std::uint64_t>{}),
+                      power(top + 1));
+        }
+    }
+}
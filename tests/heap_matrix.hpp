@@ -0,0 +1,101 @@
+// Copyright 2020 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace tests_common {
+// square matrix in heap memory that counts its allocations, an operand type whose temporaries
+// are expensive for the output-parameter protocol of power_*
+template<typename T> class heap_matrix {
+    std::size_t m_size = 0;
+    std::unique_ptr<T[]> m_data;
+
+public:
+    static inline int allocations = 0;
+
+    explicit heap_matrix(std::size_t size) : m_size(size), m_data(new T[size * size]()) {
+        ++allocations;
+    }
+    heap_matrix(const heap_matrix& other) : heap_matrix(other.m_size) {
+        std::copy(other.m_data.get(), other.m_data.get() + m_size * m_size, m_data.get());
+    }
+    heap_matrix(heap_matrix&&) = default;
+    heap_matrix& operator=(const heap_matrix& other) {
+        heap_matrix copy(other);
+        return *this = std::move(copy);
+    }
+    heap_matrix& operator=(heap_matrix&&) = default;
+
+    std::size_t size() const { return m_size; }
+    T* data() { return m_data.get(); }
+    const T* data() const { return m_data.get(); }
+    T& operator()(std::size_t i, std::size_t j) { return m_data[i * m_size + j]; }
+    T operator()(std::size_t i, std::size_t j) const { return m_data[i * m_size + j]; }
+
+    friend bool operator==(const heap_matrix& a, const heap_matrix& b) {
+        return a.m_size == b.m_size &&
+               std::equal(a.m_data.get(), a.m_data.get() + a.m_size * a.m_size, b.m_data.get());
+    }
+};
+
+// matrix product without the output-parameter protocol, every product allocates its result
+template<typename T> struct heap_matrix_multiplies_plain {
+    heap_matrix<T> operator()(const heap_matrix<T>& a, const heap_matrix<T>& b) const {
+        heap_matrix<T> out(a.size());
+        multiply(out, a, b);
+        return out;
+    }
+    static void multiply(heap_matrix<T>& out, const heap_matrix<T>& a, const heap_matrix<T>& b) {
+        // out never aliases the operands
+        const std::size_t n = a.size();
+        T* __restrict c = out.data();
+        const T* __restrict lhs = a.data();
+        const T* __restrict rhs = b.data();
+        std::fill(c, c + n * n, T(0));
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t k = 0; k < n; ++k) {
+                for (std::size_t j = 0; j < n; ++j) {
+                    c[i * n + j] += lhs[i * n + k] * rhs[k * n + j];
+                }
+            }
+        }
+    }
+};
+
+// the same product that also writes into a caller-provided output
+template<typename T> struct heap_matrix_multiplies : heap_matrix_multiplies_plain<T> {
+    using heap_matrix_multiplies_plain<T>::operator();
+    void operator()(heap_matrix<T>& out, const heap_matrix<T>& a, const heap_matrix<T>& b) const {
+        heap_matrix_multiplies_plain<T>::multiply(out, a, b);
+    }
+};
+}  // namespace tests_common
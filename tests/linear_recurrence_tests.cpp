@@ -0,0 +1,146 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <fibonacci.hpp>
+#include <linear_recurrence.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+// a(0), ..., a(count - 1) by direct iteration
+template<typename T>
+std::vector<T> naive_terms(const std::vector<T>& c, const std::vector<T>& initial, T m,
+                           std::size_t count) {
+    using Wide = typename clsc::detail::recurrence_wide<T>::type;
+    std::vector<T> terms(initial);
+    while (terms.size() < count) {
+        Wide next = 0;
+        for (std::size_t i = 0; i < c.size(); ++i) {
+            const Wide product = Wide(c[i]) * terms[terms.size() - 1 - i];
+            next = m == 0 ? Wide(T(next + product)) : (next + product % m) % m;
+        }
+        terms.push_back(T(next));
+    }
+    return terms;
+}
+
+template<typename T> void linear_recurrence_test_template(std::size_t k, T m) {
+    std::mt19937_64 generator(k);
+    std::vector<T> c(k), initial(k);
+    for (std::size_t i = 0; i < k; ++i) {
+        c[i] = T(generator());
+        initial[i] = T(generator());
+    }
+    const clsc::linear_recurrence<T> recurrence(c, initial, m);
+    EXPECT_EQ(k, recurrence.order());
+    const std::size_t count = 3 * k + 200;
+    const std::vector<T> expected = naive_terms(c, m == 0 ? initial : [&]() {
+        std::vector<T> reduced(initial);
+        for (T& value : reduced) {
+            value %= m;
+        }
+        return reduced;
+    }(), m, count);
+
+    std::vector<std::uint64_t> ns;
+    for (std::size_t n = 0; n < count; ++n) {
+        EXPECT_EQ(expected[n], recurrence(n)) << "k = " << k << ", m = " << m << ", n = " << n;
+        ns.push_back(n);
+    }
+    std::vector<T> batch(ns.size());
+    recurrence(ns.begin(), ns.end(), batch.begin());
+    EXPECT_EQ(expected, batch) << "k = " << k << ", m = " << m;
+}
+}  // namespace
+
+TEST(linear_recurrence_tests, matches_iteration_64) {
+    for (std::size_t k : {1, 2, 3, 17, 64}) {
+        linear_recurrence_test_template<std::uint64_t>(k, 1000000007);
+        linear_recurrence_test_template<std::uint64_t>(k, 0xffffffffffffffc5ull);  // 2^64 - 59
+        linear_recurrence_test_template<std::uint64_t>(k, 0x100000001ull);
+        linear_recurrence_test_template<std::uint64_t>(k, 0);  // wrapping
+        linear_recurrence_test_template<std::uint64_t>(k, 2);
+        linear_recurrence_test_template<std::uint64_t>(k, 1);
+    }
+}
+
+TEST(linear_recurrence_tests, matches_iteration_32) {
+    for (std::size_t k : {1, 5, 40}) {
+        linear_recurrence_test_template<std::uint32_t>(k, 998244353);
+        linear_recurrence_test_template<std::uint32_t>(k, 0xfffffffbu);  // 2^32 - 5
+        linear_recurrence_test_template<std::uint32_t>(k, 0);
+    }
+}
+
+TEST(linear_recurrence_tests, fibonacci) {
+    const clsc::linear_recurrence<std::uint64_t> recurrence({1, 1}, {0, 1});
+    std::vector<std::uint32_t> ns;
+    for (std::uint32_t n = 0; n < 100; ++n) {
+        ns.push_back(n);
+    }
+    for (std::uint32_t n = 100; n < 4000000000u; n = n * 3 + 1) {
+        ns.push_back(n);
+    }
+    std::vector<std::uint64_t> batch(ns.size());
+    recurrence(ns.begin(), ns.end(), batch.begin());
+    for (std::size_t i = 0; i < ns.size(); ++i) {
+        EXPECT_EQ(clsc::fibonacci(ns[i]), recurrence(ns[i])) << ns[i];
+        EXPECT_EQ(clsc::fibonacci(ns[i]), batch[i]) << ns[i];
+    }
+}
+
+TEST(linear_recurrence_tests, large_index) {
+    // a(n) = 2 * a(n - 1) gives 2^n mod m
+    const std::uint64_t m = 1000000007;
+    const clsc::linear_recurrence<std::uint64_t> doubling({2}, {1}, m);
+    const clsc::linear_recurrence<std::uint64_t> padded({2, 0, 0, 0}, {1, 2, 4, 8}, m);
+    std::uint64_t expected = 1, base = 2;
+    const std::uint64_t n = 0xfedcba9876543210ull;
+    for (std::uint64_t e = n; e != 0; e >>= 1) {
+        if (e & 1u) {
+            expected = expected * base % m;
+        }
+        base = base * base % m;
+    }
+    EXPECT_EQ(expected, doubling(n));
+    EXPECT_EQ(expected, padded(n));
+}
+
+TEST(linear_recurrence_tests, floating_point) {
+    // a(n) = a(n - 1) / 2 + a(n - 2) / 4 stays exact in binary floating point for small n
+    const clsc::linear_recurrence<double> recurrence({0.5, 0.25}, {1.0, 1.0});
+    std::vector<double> expected{1.0, 1.0};
+    for (int n = 2; n < 40; ++n) {
+        expected.push_back(expected[n - 1] * 0.5 + expected[n - 2] * 0.25);
+        EXPECT_DOUBLE_EQ(expected[n], recurrence(n)) << n;
+    }
+}
@@ -0,0 +1,121 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm.hpp>
+#include <matrix.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <random>
+
+namespace {
+template<typename T, std::size_t N> clsc::Matrix<T, N> random_matrix(std::mt19937& generator) {
+    clsc::Matrix<T, N> m;
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+            m(i, j) = T(generator() % 7);
+        }
+    }
+    return m;
+}
+
+template<typename T, std::size_t N>
+clsc::Matrix<T, N> naive_multiply(const clsc::Matrix<T, N>& a, const clsc::Matrix<T, N>& b) {
+    clsc::Matrix<T, N> c;
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+            for (std::size_t k = 0; k < N; ++k) {
+                c(i, j) += a(i, k) * b(k, j);
+            }
+        }
+    }
+    return c;
+}
+
+template<typename T, std::size_t N> void matrix_multiply_test_template() {
+    std::mt19937 generator{};
+    for (int repeat = 0; repeat < 10; ++repeat) {
+        const auto a = random_matrix<T, N>(generator);
+        const auto b = random_matrix<T, N>(generator);
+        EXPECT_TRUE(naive_multiply(a, b) == a * b) << "N = " << N;
+        EXPECT_TRUE((a == a * clsc::Matrix<T, N>::identity()));
+    }
+}
+
+template<typename T> void matrix_multiply_test_all_sizes() {
+    matrix_multiply_test_template<T, 1>();
+    matrix_multiply_test_template<T, 2>();
+    matrix_multiply_test_template<T, 3>();
+    matrix_multiply_test_template<T, 4>();
+    matrix_multiply_test_template<T, 5>();
+    matrix_multiply_test_template<T, 8>();
+    matrix_multiply_test_template<T, 12>();
+    matrix_multiply_test_template<T, 16>();
+}
+}  // namespace
+
+TEST(matrix_tests, multiply) {
+    matrix_multiply_test_all_sizes<std::int32_t>();
+    matrix_multiply_test_all_sizes<std::uint64_t>();
+    matrix_multiply_test_all_sizes<float>();
+    matrix_multiply_test_all_sizes<double>();
+}
+
+TEST(matrix_tests, storage_is_cache_aligned) {
+    EXPECT_EQ(0u, alignof(clsc::Matrix<float, 5>) % 64);
+    EXPECT_EQ(0u, alignof(clsc::Vector<double, 3>) % 64);
+}
+
+TEST(matrix_tests, linear_recurrence_with_power_monoid) {
+    // tribonacci: t(n + 3) = t(n + 2) + t(n + 1) + t(n)
+    using matrix = clsc::Matrix<std::uint64_t, 3>;
+    using vector = clsc::Vector<std::uint64_t, 3>;
+    const matrix step{1, 1, 1, 1, 0, 0, 0, 1, 0};
+    const vector initial{{1, 0, 0}};  // t(2), t(1), t(0)
+
+    std::uint64_t expected[40] = {0, 0, 1};
+    for (std::size_t n = 3; n < 40; ++n) {
+        expected[n] = expected[n - 1] + expected[n - 2] + expected[n - 3];
+    }
+    for (std::size_t n = 2; n < 40; ++n) {
+        const vector actual =
+            clsc::power_monoid(step, n - 2, std::multiplies<matrix>{}) * initial;
+        EXPECT_EQ(expected[n], actual[0]);
+    }
+}
+
+TEST(matrix_tests, walk_counting) {
+    // number of closed walks of length 10 in a 4-cycle
+    using matrix = clsc::Matrix<std::int32_t, 4>;
+    const matrix adjacency{0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0};
+    const matrix walks = clsc::power_monoid(adjacency, 10, std::multiplies<matrix>{});
+    EXPECT_EQ(512, walks(0, 0));
+    EXPECT_EQ(0, walks(0, 1));
+}
@@ -0,0 +1,112 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm.hpp>
+#include <montgomery.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+template<typename UInt> UInt naive_power_mod(UInt a, std::uint64_t n, UInt m) {
+    unsigned __int128 r = 1 % m;
+    unsigned __int128 base = a % m;
+    for (; n != 0; n >>= 1) {
+        if (n & 1u) {
+            r = r * base % m;
+        }
+        base = base * base % m;
+    }
+    return UInt(r);
+}
+
+template<typename UInt> void montgomery_power_test_template(UInt modulus) {
+    std::mt19937_64 generator{};
+    const clsc::montgomery_multiplies<UInt> op(modulus);
+    EXPECT_EQ(UInt(1 % modulus), op.from_montgomery(identity_element(op)));
+    for (int i = 0; i < 300; ++i) {
+        const UInt a = UInt(generator());
+        const std::uint64_t n = generator() >> (i % 64);
+        EXPECT_EQ(naive_power_mod(a, n, modulus), clsc::montgomery_power(a, n, op))
+            << a << "^" << n << " mod " << modulus;
+    }
+    EXPECT_EQ(UInt(1 % modulus), clsc::montgomery_power(UInt(12345), 0, op));
+}
+}  // namespace
+
+TEST(montgomery_tests, power_64) {
+    montgomery_power_test_template<std::uint64_t>(1000000007);
+    montgomery_power_test_template<std::uint64_t>(0xffffffffffffffc5ull);  // 2^64 - 59
+    montgomery_power_test_template<std::uint64_t>(0x8000000000000001ull);
+    montgomery_power_test_template<std::uint64_t>(3);
+    montgomery_power_test_template<std::uint64_t>(1);
+}
+
+TEST(montgomery_tests, power_32) {
+    montgomery_power_test_template<std::uint32_t>(998244353);
+    montgomery_power_test_template<std::uint32_t>(0xfffffffbu);  // 2^32 - 5
+    montgomery_power_test_template<std::uint32_t>(9);
+}
+
+TEST(montgomery_tests, inverse_element) {
+    const std::uint64_t prime = 0xffffffffffffffc5ull;
+    const clsc::montgomery_multiplies<std::uint64_t> op(prime);
+    for (std::uint64_t x : {std::uint64_t(1), std::uint64_t(2), std::uint64_t(12345), prime - 1}) {
+        const auto mx = op.to_montgomery(x);
+        EXPECT_EQ(1u, op.from_montgomery(op(mx, inverse_element(op)(mx))));
+        // power_group: x^-5 * x^5 == 1
+        EXPECT_EQ(1u, op.from_montgomery(op(clsc::power_group(mx, -5, op),
+                                            clsc::power_group(mx, 5, op))));
+    }
+
+    const clsc::montgomery_multiplies<std::uint32_t> composite(15);
+    EXPECT_EQ(0u, inverse_element(composite)(composite.to_montgomery(5)));
+    const auto inverse_of_7 = inverse_element(composite)(composite.to_montgomery(7));
+    EXPECT_EQ(13u, composite.from_montgomery(inverse_of_7));
+}
+
+TEST(montgomery_tests, batch_matches_scalar) {
+    std::mt19937_64 generator{};
+    const clsc::montgomery_multiplies<std::uint64_t> op(1000000000000000003ull);
+    for (std::size_t size : {0, 1, 7, 8, 9, 100}) {
+        std::vector<std::uint64_t> bases(size), exponents(size), actual(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            bases[i] = generator();
+            exponents[i] = generator() >> (i % 64);
+        }
+        auto end = clsc::montgomery_power_batch(bases.begin(), bases.end(), exponents.begin(),
+                                                actual.begin(), op);
+        EXPECT_EQ(actual.end(), end);
+        for (std::size_t i = 0; i < size; ++i) {
+            EXPECT_EQ(clsc::montgomery_power(bases[i], exponents[i], op), actual[i]);
+        }
+    }
+}
@@ -0,0 +1,107 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm.hpp>
+#include <multi_power.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace {
+struct counting_multiplies {
+    int* counter = nullptr;
+    std::uint64_t operator()(std::uint64_t a, std::uint64_t b) const {
+        ++*counter;
+        return a * b;
+    }
+};
+std::uint64_t identity_element(counting_multiplies) { return 1; }
+
+std::uint64_t separate_powers(const std::vector<std::uint64_t>& bases,
+                              const std::vector<std::uint64_t>& exponents) {
+    std::uint64_t product = 1;
+    for (std::size_t i = 0; i < bases.size(); ++i) {
+        product *= clsc::power_monoid(bases[i], exponents[i], std::multiplies<std::uint64_t>{});
+    }
+    return product;
+}
+
+template<std::size_t W> void multi_power_test_template() {
+    std::mt19937_64 generator{};
+    for (std::size_t k = 0; k <= 7; ++k) {
+        for (int repeat = 0; repeat < 20; ++repeat) {
+            std::vector<std::uint64_t> bases(k), exponents(k);
+            for (std::size_t i = 0; i < k; ++i) {
+                bases[i] = generator();
+                exponents[i] = repeat % 5 == 0 ? 0 : generator() >> (generator() % 64);
+            }
+            EXPECT_EQ(separate_powers(bases, exponents),
+                      clsc::multi_power<W>(bases, exponents, std::multiplies<std::uint64_t>{}));
+        }
+    }
+}
+}  // namespace
+
+TEST(multi_power_tests, matches_separate_powers) {
+    multi_power_test_template<0>();
+    multi_power_test_template<1>();
+    multi_power_test_template<3>();
+    multi_power_test_template<5>();
+}
+
+TEST(multi_power_tests, containers) {
+    const std::array<int, 3> bases{2, 3, 5};
+    const int exponents[] = {3, 2, 1};
+    EXPECT_EQ(8 * 9 * 5, clsc::multi_power(bases, exponents, std::multiplies<int>{}));
+    EXPECT_EQ(2 * 3 + 3 * 2 + 5, clsc::multi_power<2>(bases, exponents, std::plus<int>{}));
+}
+
+TEST(multi_power_tests, shares_squarings) {
+    std::mt19937_64 generator{};
+    const std::vector<std::uint64_t> bases{generator(), generator(), generator()};
+    const std::vector<std::uint64_t> exponents{generator() | (1ull << 63), generator(),
+                                               generator()};
+    int separate = 0;
+    for (std::size_t i = 0; i < bases.size(); ++i) {
+        clsc::power_monoid(bases[i], exponents[i], counting_multiplies{&separate});
+    }
+    int shamir = 0;
+    clsc::multi_power(bases, exponents, counting_multiplies{&shamir});
+    int windows = 0;
+    clsc::multi_power<4>(bases, exponents, counting_multiplies{&windows});
+
+    // 63 squarings + at most 64 multiplications + 4 subset products
+    EXPECT_LE(shamir, 63 + 64 + 4);
+    EXPECT_LT(2 * shamir, separate);
+    EXPECT_LT(2 * windows, separate);
+}
@@ -0,0 +1,123 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm.hpp>
+#include <permutation.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+clsc::permutation random_permutation(std::size_t n, std::mt19937& generator) {
+    std::vector<clsc::permutation::index_type> images(n);
+    std::iota(images.begin(), images.end(), 0u);
+    std::shuffle(images.begin(), images.end(), generator);
+    return clsc::permutation(images);
+}
+
+// a^n by repeated composition through the generic algorithm
+clsc::permutation generic_power(const clsc::permutation& a, std::uint64_t n) {
+    return clsc::detail::power_accumulate_semigroup(clsc::permutation(a.size()), a, n,
+                                                    clsc::permutation_compose{});
+}
+}  // namespace
+
+TEST(permutation_tests, compose) {
+    // (0 1 2) applied after the transposition (0 1)
+    const clsc::permutation cycle({1, 2, 0});
+    const clsc::permutation swap({1, 0, 2});
+    const clsc::permutation_compose op;
+    EXPECT_EQ(clsc::permutation({2, 1, 0}), op(cycle, swap));
+    EXPECT_EQ(clsc::permutation({0, 2, 1}), op(swap, cycle));
+    EXPECT_EQ(clsc::permutation(3), identity_element(clsc::permutation_compose(3)));
+}
+
+TEST(permutation_tests, inverse_element) {
+    std::mt19937 generator{};
+    const clsc::permutation_compose op;
+    for (std::size_t n : {0, 1, 2, 10, 1000}) {
+        const auto a = random_permutation(n, generator);
+        const auto inverse = inverse_element(op)(a);
+        EXPECT_EQ(clsc::permutation(n), op(a, inverse));
+        EXPECT_EQ(clsc::permutation(n), op(inverse, a));
+    }
+}
+
+TEST(permutation_tests, power_matches_composition) {
+    std::mt19937 generator{};
+    const clsc::permutation_compose op;
+    for (std::size_t n : {1, 2, 7, 100, 5000}) {
+        const auto a = random_permutation(n, generator);
+        for (std::uint64_t k : {1ull, 2ull, 3ull, 17ull, 1000ull, 0xfedcba9876543210ull}) {
+            const auto expected = generic_power(a, k);
+            EXPECT_EQ(expected, clsc::power_semigroup(a, k, op)) << n << ", " << k;
+            EXPECT_EQ(expected, clsc::power_monoid(a, k, op)) << n << ", " << k;
+            EXPECT_EQ(expected, clsc::power_group(a, k, op)) << n << ", " << k;
+        }
+        EXPECT_EQ(clsc::permutation(n), clsc::power_monoid(a, 0, op));
+    }
+}
+
+TEST(permutation_tests, negative_exponent) {
+    std::mt19937 generator{};
+    const clsc::permutation_compose op;
+    const auto a = random_permutation(1000, generator);
+    const auto inverse = inverse_element(op)(a);
+    for (std::int64_t k : {1ll, 5ll, 999ll, 123456789012345ll}) {
+        EXPECT_EQ(clsc::power_group(inverse, k, op), clsc::power_group(a, -k, op)) << k;
+        EXPECT_EQ(clsc::permutation(1000),
+                  op(clsc::power_group(a, k, op), clsc::power_group(a, -k, op)));
+    }
+    EXPECT_EQ(inverse, clsc::power_group(a, std::int8_t(-1), op));
+}
+
+TEST(permutation_tests, short_cycles) {
+    // identity, an involution and cycles of every length up to 40 side by side
+    const clsc::permutation_compose op;
+    std::vector<clsc::permutation::index_type> involution(1001), mixed;
+    for (std::uint32_t i = 0; i < 1001; ++i) {
+        involution[i] = i == 1000 ? i : i ^ 1u;
+    }
+    for (std::uint32_t length = 1; length <= 40; ++length) {
+        const std::uint32_t first = std::uint32_t(mixed.size());
+        for (std::uint32_t j = 0; j < length; ++j) {
+            mixed.push_back(first + (j + 1) % length);
+        }
+    }
+    for (const auto& a : {clsc::permutation(500), clsc::permutation(involution),
+                          clsc::permutation(mixed)}) {
+        for (std::uint64_t k : {1ull, 2ull, 3ull, 1000000007ull}) {
+            EXPECT_EQ(generic_power(a, k), clsc::power_monoid(a, k, op)) << k;
+        }
+    }
+}
@@ -0,0 +1,139 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm.hpp>
+#include <polynomial_mod.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+constexpr std::uint32_t prime = 998244353;
+
+template<std::uint32_t P>
+clsc::polynomial_mod<P> random_polynomial(std::size_t size, std::mt19937& generator) {
+    std::vector<std::uint32_t> coefficients(size);
+    for (auto& c : coefficients) {
+        c = generator() % P;
+    }
+    return clsc::polynomial_mod<P>(coefficients);
+}
+
+template<std::uint32_t P>
+clsc::polynomial_mod<P> naive_multiply(const clsc::polynomial_mod<P>& a,
+                                       const clsc::polynomial_mod<P>& b, std::size_t limit) {
+    if (a.empty() || b.empty()) {
+        return {};
+    }
+    std::vector<std::uint32_t> c(std::min(limit, a.size() + b.size() - 1));
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        for (std::size_t j = 0; j < b.size() && i + j < c.size(); ++j) {
+            c[i + j] = std::uint32_t((c[i + j] + std::uint64_t(a[i]) * b[j]) % P);
+        }
+    }
+    return clsc::polynomial_mod<P>(c);
+}
+
+// binomial(n, 0), ..., binomial(n, count - 1) modulo prime for count <= prime
+std::vector<std::uint32_t> binomials(std::uint64_t n, std::size_t count) {
+    std::vector<std::uint32_t> c(count);
+    std::uint64_t value = 1;
+    for (std::size_t i = 0; i < count; ++i) {
+        c[i] = std::uint32_t(value);
+        const std::uint64_t inverse = clsc::detail::power_mod_prime<prime>(i + 1, prime - 2);
+        value = value * ((n - i) % prime) % prime * inverse % prime;
+    }
+    return c;
+}
+
+template<std::uint32_t P> void polynomial_multiply_test_template() {
+    std::mt19937 generator{};
+    // sizes around the schoolbook, Karatsuba and NTT thresholds, balanced and not
+    const std::size_t sizes[][2] = {{1, 1},    {5, 3},     {31, 40},   {32, 32},  {33, 100},
+                                    {100, 99}, {191, 500}, {192, 192}, {700, 65}, {1000, 1500}};
+    for (const auto& size : sizes) {
+        const auto a = random_polynomial<P>(size[0], generator);
+        const auto b = random_polynomial<P>(size[1], generator);
+        const std::size_t full = std::numeric_limits<std::size_t>::max();
+        EXPECT_EQ(naive_multiply(a, b, full), a * b) << size[0] << " x " << size[1];
+        EXPECT_EQ(naive_multiply(a, a, full), a * a) << size[0] << " squared";
+        for (std::size_t limit : {std::size_t(1), std::size_t(20), size[0], size[1] + 7}) {
+            EXPECT_EQ(naive_multiply(a, b, limit), multiply_truncated(a, b, limit))
+                << size[0] << " x " << size[1] << " mod x^" << limit;
+        }
+    }
+    const clsc::polynomial_mod<P> zero;
+    EXPECT_EQ(zero, zero * random_polynomial<P>(10, generator));
+}
+}  // namespace
+
+TEST(polynomial_mod_tests, ntt_parameters) {
+    EXPECT_EQ(23u, clsc::detail::ntt_two_adicity<998244353>());
+    EXPECT_EQ(3u, clsc::detail::ntt_primitive_root<998244353>());
+    EXPECT_EQ(26u, clsc::detail::ntt_two_adicity<469762049>());
+    EXPECT_EQ(3u, clsc::detail::ntt_primitive_root<469762049>());
+    static_assert(clsc::detail::ntt_primitive_root<7340033>() == 3, "7 * 2^20 + 1");
+}
+
+TEST(polynomial_mod_tests, multiply) {
+    polynomial_multiply_test_template<998244353>();
+    polynomial_multiply_test_template<7340033>();
+    polynomial_multiply_test_template<2013265921>();  // 15 * 2^27 + 1, close to 2^31
+    // 15 * 2^9 + 1: products above 512 coefficients are longer than any transform
+    polynomial_multiply_test_template<7681>();
+}
+
+TEST(polynomial_mod_tests, construction_is_canonical) {
+    const clsc::polynomial_mod<prime> p{1, 2, 0, 0};
+    EXPECT_EQ(2u, p.size());
+    EXPECT_EQ(0u, p[7]);
+    EXPECT_EQ((clsc::polynomial_mod<prime>{1, 2}), p);
+    EXPECT_TRUE((clsc::polynomial_mod<prime>{prime, 0}).empty());
+    EXPECT_EQ((clsc::polynomial_mod<prime>{3, 2}), p + clsc::polynomial_mod<prime>{2});
+}
+
+TEST(polynomial_mod_tests, power_monoid) {
+    // (1 + x)^n has binomial coefficients
+    const clsc::polynomial_mod<prime> binomial{1, 1};
+    const auto full =
+        clsc::power_monoid(binomial, 3000, std::multiplies<clsc::polynomial_mod<prime>>{});
+    EXPECT_EQ(clsc::polynomial_mod<prime>(binomials(3000, 3001)), full);
+    EXPECT_EQ((clsc::polynomial_mod<prime>{1}),
+              clsc::power_monoid(binomial, 0, std::multiplies<clsc::polynomial_mod<prime>>{}));
+
+    const std::uint64_t n = 1000000000000ull;
+    const clsc::polynomial_mod_multiplies<prime> truncated(300);
+    EXPECT_EQ(clsc::polynomial_mod<prime>(binomials(n, 300)),
+              clsc::power_monoid(binomial, n, truncated));
+    EXPECT_EQ((clsc::polynomial_mod<prime>{1}), clsc::power_monoid(binomial, 0, truncated));
+}
@@ -0,0 +1,144 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <fibonacci.hpp>
+#include <montgomery.hpp>
+#include <reduce.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+const std::size_t thread_counts[] = {1, 2, 5};
+}  // namespace
+
+TEST(reduce_tests, empty_range_gives_identity) {
+    const std::vector<int> empty;
+    EXPECT_EQ(0, clsc::reduce_monoid(empty.begin(), empty.end(), std::plus<int>{}));
+    EXPECT_EQ(1, clsc::reduce_monoid(empty.begin(), empty.end(), std::multiplies<int>{}));
+}
+
+TEST(reduce_tests, sum_of_integers) {
+    std::mt19937 generator{};
+    for (std::size_t size : {1, 2, 15, 1000, 200001}) {
+        std::vector<std::int32_t> values(size);
+        for (auto& value : values) {
+            value = std::int32_t(generator() % 2001) - 1000;
+        }
+        const auto expected = std::accumulate(values.begin(), values.end(), std::int32_t(0));
+        for (std::size_t threads : thread_counts) {
+            EXPECT_EQ(expected, clsc::reduce_semigroup(values.begin(), values.end(),
+                                                       std::plus<std::int32_t>{}, threads));
+            EXPECT_EQ(expected, clsc::reduce_monoid(values.data(), values.data() + size,
+                                                    std::plus<std::int32_t>{}, threads));
+        }
+    }
+}
+
+TEST(reduce_tests, non_commutative_matrices) {
+    using clsc::detail::Matrix2x2;
+    std::vector<Matrix2x2> values;
+    for (std::uint64_t i = 0; i < 100000; ++i) {
+        values.push_back({i % 3, 1, 1, i % 7});
+    }
+    const auto expected = std::accumulate(values.begin(), values.end(), Matrix2x2{1, 0, 0, 1},
+                                          std::multiplies<Matrix2x2>{});
+    for (std::size_t threads : thread_counts) {
+        EXPECT_TRUE(expected == clsc::reduce_monoid(values.begin(), values.end(),
+                                                    std::multiplies<Matrix2x2>{}, threads));
+    }
+}
+
+TEST(reduce_tests, string_concatenation_keeps_order) {
+    std::vector<std::string> words(40000);
+    std::string expected;
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        words[i] = std::string(1, char('a' + i % 26));
+        expected += words[i];
+    }
+    for (std::size_t threads : thread_counts) {
+        EXPECT_EQ(expected, clsc::reduce_semigroup(words.begin(), words.end(),
+                                                   std::plus<std::string>{}, threads));
+    }
+}
+
+TEST(reduce_tests, minimum_and_maximum) {
+    std::mt19937 generator{};
+    for (std::size_t size : {1, 3, 17, 100000}) {
+        std::vector<std::int32_t> integers(size);
+        std::vector<float> floats(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            integers[i] = std::int32_t(generator());
+            floats[i] = float(std::int32_t(generator())) / 7.0f;
+        }
+        for (std::size_t threads : thread_counts) {
+            EXPECT_EQ(*std::min_element(integers.begin(), integers.end()),
+                      clsc::reduce_semigroup(integers.begin(), integers.end(),
+                                             clsc::minimum<std::int32_t>{}, threads));
+            EXPECT_EQ(*std::max_element(integers.begin(), integers.end()),
+                      clsc::reduce_semigroup(integers.begin(), integers.end(),
+                                             clsc::maximum<std::int32_t>{}, threads));
+            EXPECT_EQ(*std::min_element(floats.begin(), floats.end()),
+                      clsc::reduce_monoid(floats.data(), floats.data() + size,
+                                          clsc::minimum<float>{}, threads));
+            EXPECT_EQ(*std::max_element(floats.begin(), floats.end()),
+                      clsc::reduce_monoid(floats.data(), floats.data() + size,
+                                          clsc::maximum<float>{}, threads));
+        }
+    }
+    const std::vector<float> empty;
+    EXPECT_EQ(-std::numeric_limits<float>::infinity(),
+              clsc::reduce_monoid(empty.begin(), empty.end(), clsc::maximum<float>{}));
+}
+
+TEST(reduce_tests, commutative_operation) {
+    // the product is reordered into interleaved accumulators
+    const std::uint64_t modulus = 1000000007;
+    const clsc::montgomery_multiplies<std::uint64_t> op(modulus);
+    for (std::size_t size : {1, 7, 8, 9, 1001, 100003}) {
+        std::vector<std::uint64_t> values(size);
+        std::uint64_t expected = 1;
+        for (std::size_t i = 0; i < size; ++i) {
+            values[i] = op.to_montgomery(i + 2);
+            expected = expected * (i + 2) % modulus;
+        }
+        for (std::size_t threads : thread_counts) {
+            EXPECT_EQ(expected, op.from_montgomery(clsc::reduce_semigroup(
+                                    values.begin(), values.end(), op, threads)))
+                << size;
+        }
+    }
+}
@@ -0,0 +1,151 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <fibonacci.hpp>
+#include <scan.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+template<typename T> std::vector<T> random_values(std::size_t size, T min, T max) {
+    std::mt19937 generator{};
+    std::vector<T> values(size);
+    for (auto& value : values) {
+        if constexpr (std::is_integral<T>::value) {
+            value = std::uniform_int_distribution<T>(min, max)(generator);
+        } else {
+            value = std::uniform_real_distribution<T>(min, max)(generator);
+        }
+    }
+    return values;
+}
+
+const std::size_t sizes[] = {0, 1, 7, 31, 1000, 100003};
+const std::size_t thread_counts[] = {1, 3, 4};
+}  // namespace
+
+TEST(scan_tests, inclusive_plus_integers) {
+    for (std::size_t size : sizes) {
+        const auto values = random_values<std::int64_t>(size, -1000, 1000);
+        std::vector<std::int64_t> expected(size);
+        std::partial_sum(values.begin(), values.end(), expected.begin());
+        for (std::size_t threads : thread_counts) {
+            std::vector<std::int64_t> actual(size);
+            auto end = clsc::monoid_inclusive_scan(values.begin(), values.end(), actual.begin(),
+                                                   std::plus<std::int64_t>{}, threads);
+            EXPECT_EQ(actual.end(), end);
+            EXPECT_EQ(expected, actual);
+        }
+    }
+}
+
+TEST(scan_tests, exclusive_multiplies_integers) {
+    for (std::size_t size : sizes) {
+        const auto values = random_values<std::uint32_t>(size, 0, 0xffffffffu);
+        std::vector<std::uint32_t> expected(size);
+        std::uint32_t product = 1;
+        for (std::size_t i = 0; i < size; ++i) {
+            expected[i] = product;
+            product *= values[i];
+        }
+        for (std::size_t threads : thread_counts) {
+            std::vector<std::uint32_t> actual(size);
+            clsc::monoid_exclusive_scan(values.data(), values.data() + size, actual.data(),
+                                        std::multiplies<std::uint32_t>{}, threads);
+            EXPECT_EQ(expected, actual);
+        }
+    }
+}
+
+TEST(scan_tests, inclusive_plus_doubles) {
+    const auto values = random_values<double>(100003, 0.0, 1.0);
+    std::vector<double> expected(values.size());
+    std::partial_sum(values.begin(), values.end(), expected.begin());
+    for (std::size_t threads : thread_counts) {
+        std::vector<double> actual(values.size());
+        clsc::monoid_inclusive_scan(values.begin(), values.end(), actual.begin(),
+                                    std::plus<double>{}, threads);
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            EXPECT_NEAR(expected[i], actual[i], 1e-9 * expected[i]);
+        }
+    }
+}
+
+TEST(scan_tests, in_place) {
+    auto values = random_values<int>(50000, -10, 10);
+    std::vector<int> expected(values.size());
+    std::partial_sum(values.begin(), values.end(), expected.begin());
+    clsc::monoid_inclusive_scan(values.begin(), values.end(), values.begin(), std::plus<int>{}, 4);
+    EXPECT_EQ(expected, values);
+}
+
+TEST(scan_tests, non_commutative_matrices) {
+    using clsc::detail::Matrix2x2;
+    const auto seeds = random_values<std::uint64_t>(70001, 0, 3);
+    std::vector<Matrix2x2> values;
+    for (std::size_t i = 0; i < seeds.size(); ++i) {
+        values.push_back({seeds[i], 1, i % 2, seeds[(i + 1) % seeds.size()]});
+    }
+
+    std::vector<Matrix2x2> inclusive(values.size());
+    std::partial_sum(values.begin(), values.end(), inclusive.begin(),
+                     std::multiplies<Matrix2x2>{});
+    for (std::size_t threads : thread_counts) {
+        std::vector<Matrix2x2> actual(values.size());
+        clsc::monoid_inclusive_scan(values.begin(), values.end(), actual.begin(),
+                                    std::multiplies<Matrix2x2>{}, threads);
+        EXPECT_TRUE(inclusive == actual);
+
+        clsc::monoid_exclusive_scan(values.begin(), values.end(), actual.begin(),
+                                    std::multiplies<Matrix2x2>{}, threads);
+        EXPECT_TRUE(Matrix2x2({1, 0, 0, 1}) == actual.front());
+        EXPECT_TRUE(std::equal(inclusive.begin(), inclusive.end() - 1, actual.begin() + 1));
+    }
+}
+
+TEST(scan_tests, running_minimum) {
+    for (std::size_t size : sizes) {
+        const auto values = random_values<std::int32_t>(size, -1000000, 1000000);
+        std::vector<std::int32_t> expected(size);
+        std::partial_sum(values.begin(), values.end(), expected.begin(),
+                         [](std::int32_t a, std::int32_t b) { return std::min(a, b); });
+        for (std::size_t threads : thread_counts) {
+            std::vector<std::int32_t> actual(size);
+            clsc::monoid_inclusive_scan(values.begin(), values.end(), actual.begin(),
+                                        clsc::minimum<std::int32_t>{}, threads);
+            EXPECT_EQ(expected, actual) << size;
+        }
+    }
+}
@@ -0,0 +1,172 @@
+// Copyright 2020 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <count_until.hpp>
+#include <segmented_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <vector>
+
+namespace {
+// a sequence stored in chunks of at most chunk_size elements, followed by an empty chunk that
+// holds the end iterator: a minimal user container with segmented iterators
+class chunked_buffer {
+    std::vector<std::vector<int>> m_chunks;
+
+public:
+    static constexpr std::size_t chunk_size = 37;
+
+    class iterator {
+        const std::vector<int>* m_chunk = nullptr;
+        std::size_t m_index = 0;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const int*;
+        using reference = const int&;
+
+        iterator() = default;
+        iterator(const std::vector<int>* chunk, std::size_t index)
+            : m_chunk(chunk), m_index(index) {}
+
+        const std::vector<int>* chunk() const { return m_chunk; }
+        std::size_t index() const { return m_index; }
+
+        reference operator*() const { return (*m_chunk)[m_index]; }
+        iterator& operator++() {
+            if (++m_index == m_chunk->size()) {
+                ++m_chunk;
+                m_index = 0;
+            }
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        friend bool operator==(const iterator& x, const iterator& y) {
+            return x.m_chunk == y.m_chunk && x.m_index == y.m_index;
+        }
+        friend bool operator!=(const iterator& x, const iterator& y) { return !(x == y); }
+    };
+
+    explicit chunked_buffer(const std::vector<int>& values) {
+        for (std::size_t i = 0; i < values.size(); i += chunk_size) {
+            m_chunks.emplace_back(values.begin() + i,
+                                  values.begin() + std::min(values.size(), i + chunk_size));
+        }
+        m_chunks.emplace_back();
+    }
+
+    iterator begin() const { return iterator(m_chunks.data(), 0); }
+    iterator end() const { return iterator(m_chunks.data() + m_chunks.size() - 1, 0); }
+};
+}  // namespace
+
+template<> struct clsc::segmented_iterator_traits<chunked_buffer::iterator> : std::true_type {
+    using segment_iterator = const std::vector<int>*;
+    using local_iterator = const int*;
+
+    static segment_iterator segment(const chunked_buffer::iterator& it) { return it.chunk(); }
+    static local_iterator local(const chunked_buffer::iterator& it) {
+        return it.chunk()->data() + it.index();
+    }
+    static local_iterator begin(segment_iterator segment) { return segment->data(); }
+    static local_iterator end(segment_iterator segment) {
+        return segment->data() + segment->size();
+    }
+    static chunked_buffer::iterator compose(segment_iterator segment, local_iterator local) {
+        return chunked_buffer::iterator(segment, std::size_t(local - segment->data()));
+    }
+};
+
+static_assert(clsc::is_segmented_iterator_v<chunked_buffer::iterator>);
+static_assert(!clsc::is_segmented_iterator_v<std::vector<int>::iterator>);
+static_assert(!clsc::is_segmented_iterator_v<std::list<int>::iterator>);
+static_assert(!clsc::is_segmented_iterator_v<int*>);
+#if defined(__GLIBCXX__)
+static_assert(clsc::is_segmented_iterator_v<std::deque<int>::iterator>);
+static_assert(clsc::is_segmented_iterator_v<std::deque<double>::const_iterator>);
+#endif
+
+#if defined(__GLIBCXX__)
+TEST(segmented_iterator_tests, deque_traits) {
+    std::deque<int> values;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(i);
+        values.push_front(-i);
+    }
+    using traits = clsc::segmented_iterator_traits<std::deque<int>::const_iterator>;
+    for (auto it = values.cbegin(); it != values.cend(); ++it) {
+        const auto segment = traits::segment(it);
+        const auto local = traits::local(it);
+        EXPECT_EQ(&*it, local);
+        EXPECT_LE(traits::begin(segment), local);
+        EXPECT_LT(local, traits::end(segment));
+        EXPECT_EQ(it, traits::compose(segment, local));
+    }
+}
+#endif
+
+TEST(segmented_iterator_tests, count_until_over_chunks) {
+    std::vector<int> values(500);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = int(i);
+    }
+    const chunked_buffer buffer(values);
+    EXPECT_EQ(values.size(), std::size_t(std::distance(buffer.begin(), buffer.end())));
+    for (int hit : {0, 1, 36, 37, 38, 73, 74, 250, 499, 500}) {
+        const auto actual =
+            clsc::count_until(buffer.begin(), buffer.end(), clsc::greater_than<int>(hit - 1));
+        const auto lambda = clsc::count_until(buffer.begin(), buffer.end(),
+                                              [hit](int x) { return x >= hit; });
+        EXPECT_EQ(hit, actual.second);
+        EXPECT_EQ(std::next(buffer.begin(), hit), actual.first);
+        EXPECT_EQ(actual, lambda);
+    }
+    // ranges that start and end inside chunks
+    for (int from : {0, 5, 37, 40}) {
+        for (int to : {from, from + 1, 74, 120, 300}) {
+            const auto first = std::next(buffer.begin(), from);
+            const auto last = std::next(buffer.begin(), to);
+            const auto actual = clsc::count_until(first, last, clsc::equal_to_value<int>(100));
+            const int expected = from <= 100 && 100 < to ? 100 - from : to - from;
+            EXPECT_EQ(expected, actual.second) << from << " " << to;
+            EXPECT_EQ(std::next(first, expected), actual.first);
+        }
+    }
+}
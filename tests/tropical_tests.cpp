@@ -0,0 +1,174 @@
+// Copyright 2026 Andrey Golubev
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// ANDANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+// IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm.hpp>
+#include <tropical.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+// random directed graph: zero diagonal, about half of the edges missing
+template<typename T>
+clsc::dense_matrix<T> random_weights(std::size_t n, std::mt19937& generator) {
+    clsc::dense_matrix<T> w(n, n, clsc::tropical_infinity<T>());
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            if (i == j) {
+                w(i, j) = T(0);
+            } else if (generator() % 2 == 0) {
+                w(i, j) = T(generator() % 100 + 1);
+            }
+        }
+    }
+    return w;
+}
+
+template<typename T>
+clsc::dense_matrix<T> naive_min_plus(const clsc::dense_matrix<T>& a,
+                                     const clsc::dense_matrix<T>& b) {
+    const T infinity = clsc::tropical_infinity<T>();
+    clsc::dense_matrix<T> c(a.rows(), b.cols(), infinity);
+    for (std::size_t i = 0; i < a.rows(); ++i) {
+        for (std::size_t j = 0; j < b.cols(); ++j) {
+            for (std::size_t k = 0; k < a.cols(); ++k) {
+                c(i, j) = std::min(c(i, j), std::min(infinity, T(a(i, k) + b(k, j))));
+            }
+        }
+    }
+    return c;
+}
+
+template<typename T>
+clsc::dense_matrix<T> floyd_warshall(clsc::dense_matrix<T> d) {
+    const std::size_t n = d.rows();
+    for (std::size_t k = 0; k < n; ++k) {
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                d(i, j) = std::min(d(i, j), std::min(clsc::tropical_infinity<T>(),
+                                                     T(d(i, k) + d(k, j))));
+            }
+        }
+    }
+    return d;
+}
+
+template<typename T> void tropical_dense_test_template() {
+    std::mt19937 generator{};
+    for (std::size_t n : {1, 5, 37, 130}) {
+        const auto w = random_weights<T>(n, generator);
+        const auto w2 = naive_min_plus(w, w);
+        for (std::size_t threads : {1, 3}) {
+            const clsc::tropical_multiplies<clsc::dense_matrix<T>> op(n, threads);
+            EXPECT_TRUE(w2 == op(w, w)) << "n = " << n << ", " << threads << " threads";
+            EXPECT_TRUE(w == op(w, identity_element(op))) << "n = " << n;
+        }
+    }
+    // shortest paths have at most n - 1 edges
+    const std::size_t n = 60;
+    const auto w = random_weights<T>(n, generator);
+    const clsc::tropical_multiplies<clsc::dense_matrix<T>> op(n);
+    EXPECT_TRUE(floyd_warshall(w) == clsc::power_semigroup(w, n - 1, op));
+    EXPECT_TRUE(floyd_warshall(w) == clsc::power_monoid(w, 1000, op));
+    EXPECT_TRUE(identity_element(op) == clsc::power_monoid(w, 0, op));
+}
+
+template<typename T, std::size_t N> void tropical_fixed_test_template() {
+    std::mt19937 generator{};
+    using matrix = clsc::Matrix<T, N>;
+    const auto dense = random_weights<T>(N, generator);
+    matrix w;
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+            w(i, j) = dense(i, j);
+        }
+    }
+    const auto expected = floyd_warshall(dense);
+    const matrix paths = clsc::power_semigroup(w, N, clsc::tropical_multiplies<matrix>{});
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+            EXPECT_EQ(expected(i, j), paths(i, j)) << i << ", " << j;
+        }
+    }
+    EXPECT_TRUE(w == clsc::tropical_multiplies<matrix>{}(
+                         w, identity_element(clsc::tropical_multiplies<matrix>{})));
+}
+}  // namespace
+
+TEST(tropical_tests, dense_matrix) {
+    tropical_dense_test_template<std::int32_t>();
+    tropical_dense_test_template<float>();
+    tropical_dense_test_template<double>();
+    tropical_dense_test_template<std::int64_t>();
+}
+
+TEST(tropical_tests, fixed_size_matrix) {
+    tropical_fixed_test_template<std::int32_t, 7>();
+    tropical_fixed_test_template<float, 5>();
+    tropical_fixed_test_template<double, 16>();
+    tropical_fixed_test_template<std::int64_t, 6>();
+}
+
+TEST(tropical_tests, integer_infinity_does_not_overflow) {
+    using matrix = clsc::Matrix<std::int32_t, 2>;
+    const std::int32_t infinity = clsc::tropical_infinity<std::int32_t>();
+    const matrix disconnected{0, infinity, infinity, 0};
+    const matrix squared = clsc::power_semigroup(disconnected, 1000000,
+                                                 clsc::tropical_multiplies<matrix>{});
+    EXPECT_TRUE(disconnected == squared);
+}
+
+TEST(tropical_tests, negative_weights_keep_unreachable_vertices_infinite) {
+    // 0 -> 1 -> 2 and 0 -> 2, nothing leads back to 0 or away from 2
+    const std::int32_t infinity = clsc::tropical_infinity<std::int32_t>();
+    using matrix = clsc::Matrix<std::int32_t, 3>;
+    const matrix w{0, -5, 1, infinity, 0, 3, infinity, infinity, 0};
+    const matrix expected{0, -5, -2, infinity, 0, 3, infinity, infinity, 0};
+    EXPECT_TRUE(expected == clsc::power_semigroup(w, 3, clsc::tropical_multiplies<matrix>{}));
+
+    clsc::dense_matrix<std::int64_t> dense(3, 3);
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) {
+            dense(i, j) = w(i, j) == infinity ? clsc::tropical_infinity<std::int64_t>() : w(i, j);
+        }
+    }
+    const clsc::tropical_multiplies<clsc::dense_matrix<std::int64_t>> op(3);
+    const auto paths = clsc::power_semigroup(dense, 3, op);
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) {
+            const std::int64_t value = expected(i, j) == infinity
+                                           ? clsc::tropical_infinity<std::int64_t>()
+                                           : expected(i, j);
+            EXPECT_EQ(value, paths(i, j)) << i << ", " << j;
+        }
+    }
+}